@@ -0,0 +1,355 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/UI.hpp"
+#include "UI/Command.hpp"
+#include "UI/Table.hpp"
+#include "UI/Counters.hpp"
+#include "Steam/AppType.hpp"
+
+#include "Main.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*
+ * Microbenchmarks for some UI code paths. This replaces the bot's
+ * application() with one that just runs the benchmarks and exits.
+ *
+ * Output is CSV on stdout:
+ *    name,iterations,total_ns,ns_per_iteration
+ *
+ * Build with -D BUILD_BENCHMARKS=ON.
+ */
+
+/************************************************************************/
+
+namespace
+{
+    // results go here, so the compiler can't drop the work
+    volatile size_t sink=0;
+
+    void print(std::string_view name, size_t iterations, std::chrono::steady_clock::duration duration)
+    {
+        const int64_t total=std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        std::cout << name << ',' << iterations << ',' << total << ',' << total/static_cast<int64_t>(iterations) << std::endl;
+    }
+
+    template <typename FUNC> void run(std::string_view name, size_t iterations, FUNC&& function)
+    {
+        // warm up
+        function();
+
+        const auto start=std::chrono::steady_clock::now();
+        for (size_t i=0; i<iterations; i++)
+        {
+            function();
+        }
+        print(name, iterations, std::chrono::steady_clock::now()-start);
+    }
+
+    /*
+     * Like run(), but each iteration gets a fresh state from setup(),
+     * and only function(state) is timed.
+     */
+    template <typename SETUP, typename FUNC> void run(std::string_view name, size_t iterations, SETUP&& setup, FUNC&& function)
+    {
+        {
+            auto state=setup();
+            function(state);
+        }
+
+        std::chrono::steady_clock::duration total{};
+        for (size_t i=0; i<iterations; i++)
+        {
+            auto state=setup();
+            const auto start=std::chrono::steady_clock::now();
+            function(state);
+            total+=std::chrono::steady_clock::now()-start;
+        }
+        print(name, iterations, total);
+    }
+}
+
+/************************************************************************/
+
+namespace
+{
+    std::vector<std::string> makeNames(size_t count)
+    {
+        static const char* const words[]={ "Neptunia", "Dimension", "Hyper", "Quest", "Tactics", "Chronicles", "Legend", "Idle", "Saga", "Remastered" };
+
+        std::vector<std::string> names;
+        names.reserve(count);
+        for (size_t i=0; i<count; i++)
+        {
+            std::string name=words[(i*7)%std::size(words)];
+            name.append(" ");
+            name.append(words[(i*3+1)%std::size(words)]);
+            name.append(" ");
+            name.append(std::to_string(i));
+            names.push_back(std::move(name));
+        }
+        return names;
+    }
+}
+
+/************************************************************************/
+
+namespace
+{
+    enum class Columns : unsigned int { Name, Id, Max };
+
+    void fillTable(SteamBot::UI::Table<Columns>& table, const std::vector<std::string>& names)
+    {
+        for (size_t i=0; i<names.size(); i++)
+        {
+            SteamBot::UI::Table<Columns>::Line line;
+            line[Columns::Name] << names[i];
+            line[Columns::Id] << i;
+            table.add(line);
+        }
+    }
+
+    void benchmarkTable()
+    {
+        const auto names=makeNames(10000);
+
+        run("Table::add/10000", 20, [&names]() {
+            SteamBot::UI::Table<Columns> table;
+            fillTable(table, names);
+        });
+
+        const auto makeTable=[&names]() {
+            auto table=std::make_unique<SteamBot::UI::Table<Columns>>();
+            fillTable(*table, names);
+            return table;
+        };
+
+        run("Table::sort/10000", 20, makeTable, [](auto& table) {
+            table->sort(Columns::Name);
+        });
+
+        // startLine() walks through the table only once
+        run("Table::getFiller/10000", 20, makeTable, [](auto& table) {
+            size_t size=0;
+            while (table->startLine())
+            {
+                size+=table->getFiller(Columns::Name).size();
+            }
+            sink=sink+size;
+        });
+    }
+}
+
+/************************************************************************/
+
+namespace
+{
+    void benchmarkRegexID()
+    {
+        const auto names=makeNames(10000);
+
+        SteamBot::OptionRegexID regex;
+        regex=std::regex("neptunia.*saga", std::regex_constants::icase);
+        run("OptionRegexID::doesMatch/regex/10000", 20, [&names, &regex]() {
+            size_t count=0;
+            for (size_t i=0; i<names.size(); i++)
+            {
+                count+=regex.doesMatch(names[i], i);
+            }
+            sink=sink+count;
+        });
+
+        SteamBot::OptionRegexID id;
+        id=static_cast<uint64_t>(1234);
+        run("OptionRegexID::doesMatch/id/10000", 20, [&names, &id]() {
+            size_t count=0;
+            for (size_t i=0; i<names.size(); i++)
+            {
+                count+=id.doesMatch(names[i], i);
+            }
+            sink=sink+count;
+        });
+    }
+}
+
+/************************************************************************/
+/*
+ * A command with options like list-games; it's not registered, so it
+ * doesn't show up anywhere.
+ */
+
+namespace
+{
+    class BenchmarkCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        virtual bool global() const
+        {
+            return false;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("benchmark");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("benchmark command");
+            return string;
+        }
+
+        virtual const boost::program_options::positional_options_description* positionals() const override
+        {
+            static auto const positional=[](){
+                auto positional_=new boost::program_options::positional_options_description();
+                positional_->add("games", -1);
+                return positional_;
+            }();
+            return positional;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("games",
+                     boost::program_options::value<SteamBot::OptionRegexID>()->value_name("regex|appId"),
+                     "games to list")
+                    ("playtime",
+                     boost::program_options::bool_switch(),
+                     "sort by playtime")
+                    ("limit",
+                     boost::program_options::value<unsigned int>()->value_name("count"),
+                     "only list the first games")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI&) const override
+        {
+            return nullptr;
+        }
+    };
+
+    void benchmarkParse()
+    {
+        static const std::string line="--playtime --limit 20 \"neptunia.*\"";
+
+        run("split_unix", 100000, []() {
+            sink=sink+boost::program_options::split_unix(line).size();
+        });
+
+        const BenchmarkCommand command;
+        run("CommandBase::parse", 100000, [&command]() {
+            boost::program_options::variables_map options;
+            sink=sink+command.parse(boost::program_options::split_unix(line), options);
+        });
+    }
+}
+
+/************************************************************************/
+
+namespace
+{
+    void benchmarkCounters()
+    {
+        static constexpr SteamBot::AppType types[]={
+            SteamBot::AppType::Game, SteamBot::AppType::DLC, SteamBot::AppType::Unknown
+        };
+
+        run("Counters::add/100000", 100, []() {
+            SteamBot::UI::Counters<SteamBot::AppType> counters;
+            for (size_t i=0; i<100000; i++)
+            {
+                counters.add(types[(i*5)%std::size(types)]);
+            }
+            sink=sink+counters.get(SteamBot::AppType::Game);
+        });
+    }
+}
+
+/************************************************************************/
+
+/*
+ * We don't want the console: its manager puts the terminal into raw
+ * mode, and the scheduler would start running jobs. Text goes to
+ * stderr, so stdout only has the CSV.
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        namespace
+        {
+            class BenchmarkUI : public SteamBot::UI::Base
+            {
+            public:
+                BenchmarkUI() =default;
+                virtual ~BenchmarkUI() =default;
+
+            private:
+                virtual void outputText(ClientInfo&, std::string text) override
+                {
+                    std::cerr << text << std::endl;
+                }
+
+                virtual void requestPassword(ClientInfo&, ResultParam<std::string> result, PasswordType, bool(*)(const std::string&)) override
+                {
+                    result->completed();
+                }
+
+                virtual void quit() override
+                {
+                }
+            };
+        }
+    }
+}
+
+/************************************************************************/
+
+std::unique_ptr<SteamBot::UI::Base> SteamBot::UI::create()
+{
+    return std::make_unique<SteamBot::UI::BenchmarkUI>();
+}
+
+/************************************************************************/
+
+void application()
+{
+    std::cout << "name,iterations,total_ns,ns_per_iteration" << std::endl;
+
+    benchmarkTable();
+    benchmarkRegexID();
+    benchmarkParse();
+    benchmarkCounters();
+}
@@ -22,6 +22,8 @@
 #include <string_view>
 #include <memory>
 #include <vector>
+#include <string>
+#include <chrono>
 
 #include "UI/UI.hpp"
 
@@ -56,6 +58,14 @@ namespace SteamBot
             SteamBot::ClientInfo* currentAccount=nullptr;
             bool quit=false;
 
+            // false while commands must not read stdin: while the scheduler runs
+            // jobs, and while watch runs its command (it waits for RETURN itself)
+            bool interactive=true;
+
+        private:
+            void executeCommand(std::vector<std::string>);
+            void watch(std::vector<std::string>);
+
         public:
             CLI(ConsoleUI&);
             ~CLI();
@@ -66,8 +76,18 @@ namespace SteamBot
             void printHelp(const std::string*);
             void command(const std::string&);
 
+            // returns true if the user pressed RETURN within the time.
+            // If we're not interactive, this only waits for the time or a wakeup().
+            bool waitForReturn(std::chrono::milliseconds);
+
+            // makes waitForReturn() return early; can be called from any thread
+            void wakeup();
+
             static std::vector<std::string> getWords(std::string_view);
 
+            // expands @group, * or display names; prints a message if nothing matched
+            static std::vector<SteamBot::ClientInfo*> expandAccountName(std::string_view);
+
         public:
             void run();
 
@@ -72,6 +72,10 @@ namespace SteamBot
 
             virtual const std::string_view& description() const =0;			// short text: what does this command do
 
+            // true if execute() only hands the work to the client thread, which
+            // prints the results later through OutputText
+            virtual bool background() const;
+
             bool parse(const std::vector<std::string>&, boost::program_options::variables_map&) const;
 
             void print(std::ostream&) const;
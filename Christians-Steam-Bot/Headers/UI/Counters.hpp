@@ -0,0 +1,107 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "EnumString.hpp"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iostream>
+#include <cstdint>
+
+/************************************************************************/
+/*
+ * A small list of counters for a few distinct keys, like enum values.
+ * A linear search is faster than a map for the handful of keys this
+ * is used with.
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        template <typename T, typename U=uint32_t> class Counters
+        {
+            typedef  std::pair<T, U> Entry;
+            std::vector<Entry> counters;
+
+        public:
+            U& set(T key)
+            {
+                for (auto& entry: counters)
+                {
+                    if (entry.first==key)
+                    {
+                        return entry.second;
+                    }
+                }
+                auto &result=counters.emplace_back();
+                result.first=key;
+                return result.second;
+            }
+
+            U& add(T key)
+            {
+                return ++set(key);
+            }
+
+            U get(T key) const
+            {
+                for (auto& entry: counters)
+                {
+                    if (entry.first==key)
+                    {
+                        return entry.second;
+                    }
+                }
+                return U{};
+            }
+
+            bool empty() const
+            {
+                return counters.empty();
+            }
+
+            void sort()
+            {
+                std::sort(counters.begin(), counters.end(),
+                          [](const Entry& left, const Entry &right)
+                          {
+                              return left.second>right.second;
+                          });
+            }
+
+            void print()
+            {
+                sort();
+                for (const auto& entry: counters)
+                {
+                    std::cout << "   " << entry.second << " \xC3\x97 " << SteamBot::enumToString(entry.first) << "\n";
+                }
+            }
+
+            const auto& getCounters() const
+            {
+                return counters;
+            }
+        };
+    }
+}
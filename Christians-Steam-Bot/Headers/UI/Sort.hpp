@@ -0,0 +1,111 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include <compare>
+
+/************************************************************************/
+/*
+ * A string key that compares case-insensitively, using the same
+ * comparison as SteamBot::caseInsensitiveStringCompare().
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        class SortKey
+        {
+        private:
+            std::string string;
+
+        public:
+            explicit SortKey(std::string_view string_)
+                : string(string_)
+            {
+            }
+
+        public:
+            std::weak_ordering operator<=>(const SortKey&) const;
+            bool operator==(const SortKey&) const;
+        };
+
+        inline SortKey makeSortKey(std::string_view string)
+        {
+            return SortKey(string);
+        }
+    }
+}
+
+/************************************************************************/
+/*
+ * Sorts the items by a key that is computed just once per item,
+ * instead of comparing the items themselves over and over again.
+ *
+ * makeKey(item) must return something that has an operator<; use a
+ * std::tuple to sort on multiple keys, and makeSortKey() for strings
+ * that should be sorted case-insensitively.
+ *
+ * If limit is less than the number of items, we only sort enough to
+ * find the first "limit" items, and drop the rest.
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        template <typename T, typename FUNC> void sortItems(std::vector<T>& items, FUNC&& makeKey, size_t limit=std::numeric_limits<size_t>::max())
+        {
+            typedef std::decay_t<std::invoke_result_t<FUNC, const T&>> Key;
+
+            // The index makes the order of equal keys predictable
+            std::vector<std::pair<Key, size_t>> keys;
+            keys.reserve(items.size());
+            for (size_t i=0; i<items.size(); i++)
+            {
+                keys.emplace_back(makeKey(static_cast<const T&>(items[i])), i);
+            }
+
+            if (limit<keys.size())
+            {
+                std::partial_sort(keys.begin(), keys.begin()+static_cast<std::ptrdiff_t>(limit), keys.end());
+                keys.erase(keys.begin()+static_cast<std::ptrdiff_t>(limit), keys.end());
+            }
+            else
+            {
+                std::sort(keys.begin(), keys.end());
+            }
+
+            std::vector<T> result;
+            result.reserve(keys.size());
+            for (const auto& key : keys)
+            {
+                result.push_back(std::move(items[key.second]));
+            }
+            items=std::move(result);
+        }
+    }
+}
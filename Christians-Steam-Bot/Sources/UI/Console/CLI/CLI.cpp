@@ -19,11 +19,23 @@
 
 #include "UI/Command.hpp"
 #include "./Helpers.hpp"
+#include "./CommandTiming.hpp"
 #include "Vector.hpp"
 #include "Exceptions.hpp"
+#include "Helpers/ParseNumber.hpp"
+#include "Helpers/Destruct.hpp"
 
 #include <map>
 #include <limits>
+#include <algorithm>
+#include <sstream>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
 
 #undef max
 
@@ -74,6 +86,13 @@ const boost::program_options::options_description* SteamBot::UI::CommandBase::op
 
 /************************************************************************/
 
+bool SteamBot::UI::CommandBase::background() const
+{
+    return false;
+}
+
+/************************************************************************/
+
 bool SteamBot::UI::CommandBase::parse(const std::vector<std::string>& args, boost::program_options::variables_map& variables) const
 {
     try
@@ -236,7 +255,7 @@ void CLI::printHelp(const std::string* theCommand)
  * Supports display names as well.
  */
 
-static std::vector<SteamBot::ClientInfo*> expandAccountName(std::string_view name)
+std::vector<SteamBot::ClientInfo*> CLI::expandAccountName(std::string_view name)
 {
     std::vector<SteamBot::ClientInfo*> result;
 
@@ -287,13 +306,51 @@ static std::vector<SteamBot::ClientInfo*> expandAccountName(std::string_view nam
  * Also note that you can use display names. we will first search for
  * an account name, and if none is found we'll search for a display
  * name.
+ *
+ * The entire command line can be prefixed with "time" to get a
+ * timing report after the command has run, or with "watch" to
+ * repeat it.
+ *
+ * If the command fails with an exception, we print it and carry on.
  */
 
 void CLI::command(const std::string& line)
+{
+    try
+    {
+        auto args=boost::program_options::split_unix(line);
+        if (args.size()>0 && args[0]=="watch")
+        {
+            args.erase(args.begin());
+            watch(std::move(args));
+        }
+        else
+        {
+            executeCommand(std::move(args));
+        }
+    }
+    catch(const SteamBot::OperationCancelledException&)
+    {
+        throw;
+    }
+    catch(const std::exception& exception)
+    {
+        std::cout << "command failed: " << exception.what() << std::endl;
+    }
+}
+
+/************************************************************************/
+
+void CLI::executeCommand(std::vector<std::string> args)
 {
     std::vector<SteamBot::ClientInfo*> clients;
 
-    auto args=boost::program_options::split_unix(line);
+    std::unique_ptr<CommandTiming> timing;
+    if (args.size()>0 && args[0]=="time")
+    {
+        args.erase(args.begin());
+        timing=std::make_unique<CommandTiming>();
+    }
 
     if (args.size()>0)
     {
@@ -334,8 +391,13 @@ void CLI::command(const std::string& line)
                 auto execute=command.makeExecute(*this);
                 if (execute->init(options))
                 {
+                    if (timing && command.background())
+                    {
+                        timing->setBackground();
+                    }
                     if (command.global())
                     {
+                        CommandTiming::Measure measure(timing.get(), nullptr);
                         execute->execute(nullptr);
                     }
                     else
@@ -348,15 +410,27 @@ void CLI::command(const std::string& line)
                                 // ToDo: add some trickery to run execute() on the client thread, but
                                 // only for commands that are not "launch"
                                 boost::this_fiber::sleep_for(delay);
-                                execute->execute(clientInfo);
+                                if (timing)
+                                {
+                                    timing->addDelay(delay);
+                                }
+                                {
+                                    CommandTiming::Measure measure(timing.get(), clientInfo);
+                                    execute->execute(clientInfo);
+                                }
                                 delay+=std::chrono::seconds(2);
                             }
                         }
                         else
                         {
                             std::cout << "no current account; select one first or specify an account name" << std::endl;
+                            timing.reset();
                         }
                     }
+                    if (timing)
+                    {
+                        timing->print(std::cout);
+                    }
                 }
                 else
                 {
@@ -376,6 +450,242 @@ void CLI::command(const std::string& line)
     }
 }
 
+/************************************************************************/
+/*
+ * Returns the number of columns and rows of the terminal, or 0/0 if
+ * we can't tell.
+ */
+
+static std::pair<size_t, size_t> getTerminalSize()
+{
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info))
+    {
+        return std::make_pair(static_cast<size_t>(info.srWindow.Right-info.srWindow.Left+1),
+                              static_cast<size_t>(info.srWindow.Bottom-info.srWindow.Top+1));
+    }
+#else
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size)==0)
+    {
+        return std::make_pair(static_cast<size_t>(size.ws_col), static_cast<size_t>(size.ws_row));
+    }
+#endif
+    return std::make_pair(0, 0);
+}
+
+/************************************************************************/
+/*
+ * Moving the cursor up only works if every line is one row on the
+ * screen, and all of them are still visible.
+ *
+ * Note: this counts UTF-8 characters, which is good enough for the
+ * names we print.
+ */
+
+static bool fitsTerminal(const std::vector<std::string>& lines, size_t columns, size_t rows)
+{
+    if (columns==0 || rows==0 || lines.size()>=rows)
+    {
+        return false;
+    }
+    for (const auto& line : lines)
+    {
+        size_t width=0;
+        for (const char c : line)
+        {
+            if ((static_cast<unsigned char>(c) & 0xc0)!=0x80)
+            {
+                width++;
+            }
+        }
+        if (width>=columns)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*
+ * Returns the command that executeCommand() would run for the words,
+ * skipping the "time" and "<account>:" prefixes.
+ */
+
+static const SteamBot::UI::CommandBase* findCommand(const std::vector<std::string>& args)
+{
+    size_t index=0;
+    if (index<args.size() && args[index]=="time")
+    {
+        index++;
+    }
+    if (index<args.size() && args[index].size()>0 && args[index].back()==':')
+    {
+        index++;
+    }
+    if (index<args.size())
+    {
+        auto iterator=getCommands().find(args[index]);
+        if (iterator!=getCommands().end())
+        {
+            return iterator->second.get();
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*
+ * "watch [--interval <seconds>] <command>"
+ *
+ * Runs the command repeatedly until RETURN is pressed. The output is
+ * captured, and we only redraw the lines that have changed since the
+ * last run.
+ *
+ * We can only capture what the command prints on the UI thread, so
+ * commands that print their results in the background are refused.
+ *
+ * While the command runs, we are not interactive: RETURN is left
+ * in stdin for our own waitForReturn(), instead of cancelling a
+ * Helpers::execute() in the command.
+ *
+ * Since that needs someone to press RETURN, it's not available for
+ * scheduled jobs.
+ */
+
+void CLI::watch(std::vector<std::string> args)
+{
+    if (!interactive)
+    {
+        std::cout << "watch cannot be used in scheduled jobs" << std::endl;
+        return;
+    }
+
+    // the longest interval we accept; it must fit the poll() timeout
+    static constexpr std::chrono::seconds maxInterval=std::chrono::hours(24);
+
+    std::chrono::seconds interval(5);
+    if (args.size()>=2 && (args[0]=="--interval" || args[0]=="-n"))
+    {
+        uint64_t seconds;
+        if (!SteamBot::parseNumber(args[1], seconds) || seconds==0)
+        {
+            std::cout << "invalid interval \"" << args[1] << "\"" << std::endl;
+            return;
+        }
+        interval=std::chrono::seconds(static_cast<std::chrono::seconds::rep>(std::min<uint64_t>(seconds, maxInterval.count())));
+        args.erase(args.begin(), args.begin()+2);
+    }
+
+    if (args.empty())
+    {
+        std::cout << "watch [--interval <seconds>] <command>" << std::endl;
+        return;
+    }
+
+    if (auto command=findCommand(args))
+    {
+        if (command->background())
+        {
+            std::cout << command->command() << " prints its results in the background, so it can't be watched" << std::endl;
+            return;
+        }
+    }
+
+#ifdef _WIN32
+    // The redraw uses ANSI escape sequences, which the Windows console only understands when asked to
+    const HANDLE console=GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD consoleMode;
+    if (!GetConsoleMode(console, &consoleMode) || !SetConsoleMode(console, consoleMode | ENABLE_VIRTUAL_TERMINAL_PROCESSING))
+    {
+        std::cout << "watch needs a console that supports ANSI escape sequences" << std::endl;
+        return;
+    }
+    SteamBot::ExecuteOnDestruct restoreMode([console, consoleMode]() { SetConsoleMode(console, consoleMode); });
+#endif
+
+    std::cout << "repeating every " << interval.count() << " seconds; press RETURN to stop" << std::endl;
+
+    std::vector<std::string> previous;
+    do
+    {
+        std::ostringstream output;
+        {
+            auto saved=std::cout.rdbuf(output.rdbuf());
+            interactive=false;
+            SteamBot::ExecuteOnDestruct restore([this, saved]() {
+                std::cout.rdbuf(saved);
+                interactive=true;
+            });
+            executeCommand(args);
+        }
+
+        std::vector<std::string> lines;
+        {
+            std::istringstream stream(std::move(output).str());
+            std::string line;
+            while (std::getline(stream, line))
+            {
+                lines.push_back(std::move(line));
+            }
+        }
+
+        const auto size=getTerminalSize();
+        if (previous.empty() || (fitsTerminal(previous, size.first, size.second) && fitsTerminal(lines, size.first, size.second)))
+        {
+            // Move back to the start of our previous output, then rewrite what has changed
+            if (!previous.empty())
+            {
+                std::cout << "\x1b[" << previous.size() << "F";
+            }
+            for (size_t i=0; i<lines.size(); i++)
+            {
+                if (i<previous.size() && previous[i]==lines[i])
+                {
+                    std::cout << "\x1b[1E";
+                }
+                else
+                {
+                    std::cout << "\x1b[2K" << lines[i] << '\n';
+                }
+            }
+            if (lines.size()<previous.size())
+            {
+                std::cout << "\x1b[J";
+            }
+        }
+        else
+        {
+            // Clear the screen and print everything again
+            std::cout << "\x1b[H\x1b[2J";
+            for (const auto& line : lines)
+            {
+                std::cout << line << '\n';
+            }
+        }
+        std::cout << std::flush;
+
+        previous=std::move(lines);
+    }
+    while (!waitForReturn(interval));
+}
+
+/************************************************************************/
+
+bool CLI::waitForReturn(std::chrono::milliseconds timeout)
+{
+    return ui.getLine->wait(timeout, interactive);
+}
+
+/************************************************************************/
+
+void CLI::wakeup()
+{
+    ui.getLine->wakeup();
+}
+
 /************************************************************************/
 
 void CLI::run()
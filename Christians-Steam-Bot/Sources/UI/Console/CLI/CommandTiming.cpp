@@ -0,0 +1,161 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "./CommandTiming.hpp"
+
+#include "Client/ClientInfo.hpp"
+
+#include <iomanip>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+/************************************************************************/
+
+typedef SteamBot::UI::CommandTiming CommandTiming;
+
+/************************************************************************/
+/*
+ * CPU time used by the calling thread
+ */
+
+static std::chrono::nanoseconds getThreadTime()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+    {
+        const auto ticks=(static_cast<uint64_t>(kernel.dwHighDateTime)<<32 | kernel.dwLowDateTime)+(static_cast<uint64_t>(user.dwHighDateTime)<<32 | user.dwLowDateTime);
+        return std::chrono::nanoseconds(ticks*100);
+    }
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)==0)
+    {
+        return std::chrono::seconds(ts.tv_sec)+std::chrono::nanoseconds(ts.tv_nsec);
+    }
+#endif
+    return std::chrono::nanoseconds(0);
+}
+
+/************************************************************************/
+
+template <typename T> static std::ostream& printDuration(std::ostream& stream, T duration)
+{
+    const auto flags=stream.flags();
+    const auto precision=stream.precision();
+    stream << std::fixed << std::setprecision(3) << std::chrono::duration<double>(duration).count() << "s";
+    stream.flags(flags);
+    stream.precision(precision);
+    return stream;
+}
+
+/************************************************************************/
+
+CommandTiming::CommandTiming()
+    : start(Clock::now())
+{
+}
+
+/************************************************************************/
+
+CommandTiming::~CommandTiming() =default;
+
+/************************************************************************/
+
+CommandTiming::Measure::Measure(CommandTiming* timing_, const SteamBot::ClientInfo* clientInfo_)
+    : timing(timing_), clientInfo(clientInfo_)
+{
+    if (timing!=nullptr)
+    {
+        wallStart=Clock::now();
+        cpuStart=getThreadTime();
+    }
+}
+
+/************************************************************************/
+
+CommandTiming::Measure::~Measure()
+{
+    if (timing!=nullptr)
+    {
+        auto& entry=timing->entries.emplace_back();
+        entry.clientInfo=clientInfo;
+        entry.wallTime=Clock::now()-wallStart;
+        entry.cpuTime=getThreadTime()-cpuStart;
+    }
+}
+
+/************************************************************************/
+
+void CommandTiming::addDelay(Clock::duration duration)
+{
+    delay+=duration;
+}
+
+/************************************************************************/
+
+void CommandTiming::setBackground()
+{
+    background=true;
+}
+
+/************************************************************************/
+
+void CommandTiming::print(std::ostream& stream) const
+{
+    std::chrono::nanoseconds cpuTime{0};
+    for (const auto& entry : entries)
+    {
+        cpuTime+=entry.cpuTime;
+    }
+
+    const auto wallTime=Clock::now()-start;
+
+    stream << "time: ";
+    printDuration(stream, wallTime) << " wall, ";
+    printDuration(stream, cpuTime) << " UI thread, ";
+    printDuration(stream, wallTime-cpuTime-delay) << " waiting";
+    if (delay.count()!=0)
+    {
+        stream << ", ";
+        printDuration(stream, delay) << " delay between accounts";
+    }
+    stream << '\n';
+
+    if (background)
+    {
+        stream << "   (the command runs in the background; this only covers starting it)\n";
+    }
+    else if (entries.size()>1 || (entries.size()==1 && entries.front().clientInfo!=nullptr))
+    {
+        for (const auto& entry : entries)
+        {
+            stream << "   " << (entry.clientInfo!=nullptr ? entry.clientInfo->accountName : std::string_view("(global)")) << ": ";
+            printDuration(stream, entry.wallTime) << " wall, ";
+            printDuration(stream, entry.cpuTime) << " UI thread, ";
+            printDuration(stream, entry.wallTime-entry.cpuTime) << " waiting\n";
+        }
+    }
+
+    stream << std::flush;
+}
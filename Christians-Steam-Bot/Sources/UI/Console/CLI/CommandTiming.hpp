@@ -0,0 +1,97 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <ostream>
+
+/************************************************************************/
+
+namespace SteamBot
+{
+    class ClientInfo;
+}
+
+/************************************************************************/
+/*
+ * Collects the numbers for the "time" command prefix.
+ *
+ * For each execute() we record the wall time and the CPU time used
+ * by the UI thread. Note that the thread time includes everything
+ * that runs on the UI thread in the meantime, not just the command.
+ *
+ * The rest of the wall time is reported as "waiting": the UI thread
+ * was blocked, on a client thread, on Steam, on the user, or simply
+ * wasn't scheduled. We can't tell these apart.
+ *
+ * Commands that run in the background return from execute() as soon
+ * as the work has been handed to the client thread, so we only time
+ * that hand-off. We don't print the accounts for them.
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        class CommandTiming
+        {
+        private:
+            typedef std::chrono::steady_clock Clock;
+
+            struct Entry
+            {
+                const SteamBot::ClientInfo* clientInfo=nullptr;
+                Clock::duration wallTime{0};
+                std::chrono::nanoseconds cpuTime{0};
+            };
+
+        private:
+            Clock::time_point start;
+            Clock::duration delay{0};
+            std::vector<Entry> entries;
+            bool background=false;
+
+        public:
+            CommandTiming();
+            ~CommandTiming();
+
+        public:
+            // Measures the lifetime of the object. Does nothing if the timing is nullptr.
+            class Measure
+            {
+            private:
+                CommandTiming* timing;
+                Clock::time_point wallStart;
+                std::chrono::nanoseconds cpuStart;
+                const SteamBot::ClientInfo* clientInfo;
+
+            public:
+                Measure(CommandTiming*, const SteamBot::ClientInfo*);
+                ~Measure();
+            };
+
+        public:
+            void addDelay(Clock::duration);
+            void setBackground();
+            void print(std::ostream&) const;
+        };
+    }
+}
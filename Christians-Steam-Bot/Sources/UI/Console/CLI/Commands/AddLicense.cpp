@@ -62,6 +62,11 @@ namespace
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
         virtual const boost::program_options::options_description* options() const override
         {
             static auto const options=[this](){
@@ -0,0 +1,465 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+#include "UI/Table.hpp"
+#include "UI/Sort.hpp"
+
+#include "../Helpers.hpp"
+
+#include "AppInfo.hpp"
+#include "Steam/AppType.hpp"
+#include "EnumString.hpp"
+
+#include <bit>
+#include <unordered_map>
+
+/************************************************************************/
+/*
+ * Every app that is owned by any of the accounts gets a dense index,
+ * so we can keep one bitset per account. Everything else is then just
+ * AND/OR/popcount over a few kilobytes of words, which the compiler
+ * vectorizes for us.
+ */
+
+/************************************************************************/
+
+namespace
+{
+    class CompareGamesCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        virtual bool global() const
+        {
+            return true;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("compare-games");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("compare game libraries of accounts");
+            return string;
+        }
+
+        virtual const boost::program_options::positional_options_description* positionals() const override
+        {
+            static auto const positional=[](){
+                auto positional_=new boost::program_options::positional_options_description();
+                positional_->add("accounts", -1);
+                return positional_;
+            }();
+            return positional;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("accounts",
+                     boost::program_options::value<std::vector<std::string>>()->multitoken(),
+                     "accounts to compare (default: all running accounts)")
+                    ("owns",
+                     boost::program_options::value<SteamBot::OptionRegexID>()->value_name("regex|appId"),
+                     "list which accounts own these games")
+                    ("unique",
+                     boost::program_options::bool_switch(),
+                     "list games that only one account owns")
+                    ("common",
+                     boost::program_options::bool_switch(),
+                     "list games that all accounts own")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+    public:
+        class Execute : public ExecuteBase
+        {
+        private:
+            std::vector<std::string> accounts;
+            std::optional<SteamBot::OptionRegexID> owns;
+            bool unique=false;
+            bool common=false;
+
+        public:
+            using ExecuteBase::ExecuteBase;
+
+            virtual ~Execute() =default;
+
+        public:
+            virtual bool init(const boost::program_options::variables_map& options) override
+            {
+                if (options.count("accounts"))
+                {
+                    accounts=options["accounts"].as<std::vector<std::string>>();
+                }
+                if (options.count("owns"))
+                {
+                    owns=options["owns"].as<SteamBot::OptionRegexID>();
+                }
+                unique=options["unique"].as<bool>();
+                common=options["common"].as<bool>();
+                return true;
+            }
+
+            virtual void execute(SteamBot::ClientInfo*) const override;
+        };
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
+        {
+            return std::make_shared<Execute>(cli);
+        }
+    };
+
+    CompareGamesCommand::Init<CompareGamesCommand> init;
+}
+
+/************************************************************************/
+
+namespace
+{
+    class AppSet
+    {
+    private:
+        std::vector<uint64_t> words;
+
+    public:
+        AppSet(size_t size)
+            : words((size+63)/64, 0)
+        {
+        }
+
+    public:
+        void set(size_t index)
+        {
+            words[index/64]|=uint64_t(1)<<(index%64);
+        }
+
+        bool test(size_t index) const
+        {
+            return (words[index/64]>>(index%64))&1;
+        }
+
+        size_t count() const
+        {
+            size_t result=0;
+            for (const auto word : words)
+            {
+                result+=static_cast<size_t>(std::popcount(word));
+            }
+            return result;
+        }
+
+        AppSet& operator&=(const AppSet& other)
+        {
+            for (size_t i=0; i<words.size(); i++)
+            {
+                words[i]&=other.words[i];
+            }
+            return *this;
+        }
+
+        AppSet& operator|=(const AppSet& other)
+        {
+            for (size_t i=0; i<words.size(); i++)
+            {
+                words[i]|=other.words[i];
+            }
+            return *this;
+        }
+
+        AppSet& operator-=(const AppSet& other)
+        {
+            for (size_t i=0; i<words.size(); i++)
+            {
+                words[i]&=~other.words[i];
+            }
+            return *this;
+        }
+
+        void fill()
+        {
+            std::fill(words.begin(), words.end(), ~uint64_t(0));
+        }
+    };
+}
+
+/************************************************************************/
+
+namespace
+{
+    class Library
+    {
+    public:
+        std::vector<const SteamBot::ClientInfo*> accounts;
+        std::vector<SteamBot::AppID> apps;
+        std::vector<AppSet> owned;
+
+    private:
+        std::unordered_map<SteamBot::AppID, size_t> index;
+        std::vector<std::vector<size_t>> indices;
+
+    public:
+        void add(const SteamBot::ClientInfo&);
+        void build();
+
+        std::vector<AppSet> getUnique() const;
+        AppSet getCommon() const;
+    };
+}
+
+/************************************************************************/
+/*
+ * Like list-games, this looks at the apps in our licenses.
+ *
+ * We don't know the number of apps until we have seen all accounts,
+ * so we just collect the indices here; build() makes the bitsets.
+ */
+
+void Library::add(const SteamBot::ClientInfo& clientInfo)
+{
+    const CLI::Helpers::GameInfo gameInfo(clientInfo);
+
+    auto& list=indices.emplace_back();
+    if (gameInfo.licenses)
+    {
+        CLI::Helpers::forEachLicensedApp(*gameInfo.licenses, [this, &list](const CLI::Helpers::LicenseInfo&, SteamBot::AppID appId) {
+            auto result=index.try_emplace(appId, apps.size());
+            if (result.second)
+            {
+                apps.push_back(appId);
+            }
+            list.push_back(result.first->second);
+        });
+    }
+
+    accounts.push_back(&clientInfo);
+}
+
+/************************************************************************/
+/*
+ * DLCs are not games, so they don't go into the bitsets.
+ */
+
+void Library::build()
+{
+    AppSet games(apps.size());
+    for (size_t i=0; i<apps.size(); i++)
+    {
+        if (SteamBot::AppInfo::getAppType(apps[i])!=SteamBot::AppType::DLC)
+        {
+            games.set(i);
+        }
+    }
+
+    owned.clear();
+    owned.reserve(indices.size());
+    for (const auto& list : indices)
+    {
+        AppSet& set=owned.emplace_back(apps.size());
+        for (const auto i : list)
+        {
+            set.set(i);
+        }
+        set&=games;
+    }
+    indices.clear();
+}
+
+/************************************************************************/
+/*
+ * For each account, the apps that no other account owns.
+ *
+ * To avoid comparing every account against every other one, we
+ * build the union of all accounts before and after each account.
+ */
+
+std::vector<AppSet> Library::getUnique() const
+{
+    const size_t count=owned.size();
+
+    std::vector<AppSet> before(count, AppSet(apps.size()));
+    for (size_t i=1; i<count; i++)
+    {
+        before[i]=before[i-1];
+        before[i]|=owned[i-1];
+    }
+
+    std::vector<AppSet> result;
+    result.reserve(count);
+
+    AppSet after(apps.size());
+    for (size_t i=count; i-->0;)
+    {
+        AppSet unique=owned[i];
+        unique-=before[i];
+        unique-=after;
+        result.push_back(std::move(unique));
+        after|=owned[i];
+    }
+    std::reverse(result.begin(), result.end());
+
+    return result;
+}
+
+/************************************************************************/
+
+AppSet Library::getCommon() const
+{
+    AppSet result(apps.size());
+    result.fill();
+    for (const auto& set : owned)
+    {
+        result&=set;
+    }
+    return result;
+}
+
+/************************************************************************/
+
+static void printApps(const Library& library, const AppSet& set, const char* indent)
+{
+    std::vector<std::pair<SteamBot::AppID, std::string>> items;
+    for (size_t i=0; i<library.apps.size(); i++)
+    {
+        if (set.test(i))
+        {
+            items.emplace_back(library.apps[i], CLI::Helpers::getAppName(library.apps[i]));
+        }
+    }
+
+    SteamBot::UI::sortItems(items, [](const auto& item) {
+        return SteamBot::UI::makeSortKey(item.second);
+    });
+
+    for (const auto& item : items)
+    {
+        std::cout << indent << SteamBot::toInteger(item.first) << ": " << item.second << '\n';
+    }
+}
+
+/************************************************************************/
+
+void CompareGamesCommand::Execute::execute(SteamBot::ClientInfo*) const
+{
+    const auto clients=CLI::Helpers::expandAccountNames(accounts);
+
+    Library library;
+    for (const auto clientInfo : clients)
+    {
+        if (clientInfo->getClient())
+        {
+            library.add(*clientInfo);
+        }
+        else
+        {
+            std::cout << "account \"" << clientInfo->accountName << "\" is not running; skipping" << std::endl;
+        }
+    }
+
+    if (library.accounts.empty())
+    {
+        return;
+    }
+    library.build();
+
+    const auto uniqueSets=library.getUnique();
+    const auto commonSet=library.getCommon();
+
+    if (owns)
+    {
+        for (size_t i=0; i<library.apps.size(); i++)
+        {
+            const auto name=CLI::Helpers::getAppName(library.apps[i]);
+            if (owns->doesMatch(name, library.apps[i]))
+            {
+                std::vector<const SteamBot::ClientInfo*> owners;
+                for (size_t j=0; j<library.accounts.size(); j++)
+                {
+                    if (library.owned[j].test(i))
+                    {
+                        owners.push_back(library.accounts[j]);
+                    }
+                }
+                if (!owners.empty())
+                {
+                    std::cout << SteamBot::toInteger(library.apps[i]) << ": " << name << '\n';
+                    for (const auto owner : owners)
+                    {
+                        std::cout << "   " << owner->accountName << '\n';
+                    }
+                }
+            }
+        }
+    }
+    else if (unique)
+    {
+        for (size_t i=0; i<library.accounts.size(); i++)
+        {
+            if (uniqueSets[i].count()!=0)
+            {
+                std::cout << library.accounts[i]->accountName << ":\n";
+                printApps(library, uniqueSets[i], "   ");
+            }
+        }
+    }
+    else if (common)
+    {
+        printApps(library, commonSet, "");
+    }
+    else
+    {
+        enum class Columns : unsigned int { Account, Owned, Unique, Max };
+        SteamBot::UI::Table<Columns> table;
+
+        AppSet all(library.apps.size());
+        for (size_t i=0; i<library.accounts.size(); i++)
+        {
+            decltype(table)::Line line;
+            line[Columns::Account] << library.accounts[i]->accountName;
+            line[Columns::Owned] << library.owned[i].count();
+            line[Columns::Unique] << uniqueSets[i].count();
+            table.add(line);
+
+            all|=library.owned[i];
+        }
+
+        table.sort(Columns::Account);
+        std::cout << "account: owned | unique\n";
+        while (table.startLine())
+        {
+            std::cout << table.getContent(Columns::Account) << table.getFiller(Columns::Account);
+            std::cout << " | " << table.getFiller(Columns::Owned) << table.getContent(Columns::Owned);
+            std::cout << " | " << table.getFiller(Columns::Unique) << table.getContent(Columns::Unique) << '\n';
+        }
+
+        std::cout << "games owned by any account: " << all.count() << '\n';
+        std::cout << "games owned by all accounts: " << commonSet.count() << '\n';
+    }
+
+    std::cout << std::flush;
+}
@@ -47,6 +47,11 @@ namespace
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
     public:
         class Execute : public ExecuteBase
         {
@@ -62,7 +67,11 @@ namespace
                 {
                     bool success=SteamBot::Modules::Executor::executeWithFiber(client, [](SteamBot::Client&) {
                         SteamBot::UI::OutputText() << "ClI: requested discovery queue clearing";
+                        // clear() doesn't tell us how many items it went through, so we can only report the time
+                        const auto start=std::chrono::steady_clock::now();
                         SteamBot::DiscoveryQueue::clear();
+                        const auto seconds=std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now()-start);
+                        SteamBot::UI::OutputText() << "ClI: discovery queue clearing finished after " << seconds.count() << " seconds";
                     });
                     if (success)
                     {
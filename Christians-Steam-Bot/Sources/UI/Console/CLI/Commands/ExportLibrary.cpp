@@ -0,0 +1,311 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+
+#include "../Helpers.hpp"
+
+#include "AppInfo.hpp"
+#include "Steam/AppType.hpp"
+#include "EnumString.hpp"
+
+#include <fstream>
+#include <unordered_set>
+#include <initializer_list>
+
+/************************************************************************/
+/*
+ * Writes one CSV line for every app in the licenses of the accounts:
+ *    account,appId,type,name,packageId,playtime,lastPlayed,cardsEarned,cardsReceived
+ *
+ * playtime is in minutes, lastPlayed in seconds since 1970 (or empty).
+ *
+ * We only ever look at one account at a time, and write its lines
+ * in chunks as we go, so memory use doesn't depend on the number
+ * of accounts.
+ */
+
+/************************************************************************/
+
+namespace
+{
+    class ExportLibraryCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        virtual bool global() const
+        {
+            return true;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("export-library");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("write the game libraries of accounts to a CSV file");
+            return string;
+        }
+
+        virtual const boost::program_options::positional_options_description* positionals() const override
+        {
+            static auto const positional=[](){
+                auto positional_=new boost::program_options::positional_options_description();
+                positional_->add("file", 1);
+                positional_->add("accounts", -1);
+                return positional_;
+            }();
+            return positional;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("file",
+                     boost::program_options::value<std::string>()->required(),
+                     "file to write")
+                    ("accounts",
+                     boost::program_options::value<std::vector<std::string>>()->multitoken(),
+                     "accounts to export (default: all running accounts)")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+    public:
+        class Execute : public ExecuteBase
+        {
+        private:
+            std::string filename;
+            std::vector<std::string> accounts;
+
+        public:
+            using ExecuteBase::ExecuteBase;
+
+            virtual ~Execute() =default;
+
+        public:
+            virtual bool init(const boost::program_options::variables_map& options) override
+            {
+                filename=options["file"].as<std::string>();
+                if (options.count("accounts"))
+                {
+                    accounts=options["accounts"].as<std::vector<std::string>>();
+                }
+                return true;
+            }
+
+            virtual void execute(SteamBot::ClientInfo*) const override;
+        };
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
+        {
+            return std::make_shared<Execute>(cli);
+        }
+    };
+
+    ExportLibraryCommand::Init<ExportLibraryCommand> init;
+}
+
+/************************************************************************/
+
+static void appendField(std::string& line, std::string_view field)
+{
+    if (field.find_first_of(",\"\r\n")==std::string_view::npos)
+    {
+        line.append(field);
+    }
+    else
+    {
+        line.push_back('"');
+        for (const char c : field)
+        {
+            if (c=='"')
+            {
+                line.push_back('"');
+            }
+            line.push_back(c);
+        }
+        line.push_back('"');
+    }
+}
+
+/************************************************************************/
+
+namespace
+{
+    class Writer
+    {
+    private:
+        static constexpr size_t chunkSize=64*1024;
+
+        std::ofstream& stream;
+        std::string buffer;
+
+    public:
+        size_t lines=0;
+
+    public:
+        Writer(std::ofstream& stream_)
+            : stream(stream_)
+        {
+            buffer.reserve(chunkSize);
+        }
+
+        ~Writer()
+        {
+            flush();
+        }
+
+    public:
+        void flush()
+        {
+            stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            stream.flush();
+            buffer.clear();
+        }
+
+        void line(std::initializer_list<std::string_view> fields)
+        {
+            bool first=true;
+            for (const auto field : fields)
+            {
+                if (!first)
+                {
+                    buffer.push_back(',');
+                }
+                first=false;
+                appendField(buffer, field);
+            }
+            buffer.push_back('\n');
+            lines++;
+
+            if (buffer.size()>=chunkSize)
+            {
+                flush();
+            }
+        }
+    };
+}
+
+/************************************************************************/
+
+static void exportAccount(Writer& writer, const SteamBot::ClientInfo& clientInfo)
+{
+    const CLI::Helpers::GameInfo gameInfo(clientInfo);
+    if (!gameInfo.licenses)
+    {
+        std::cout << "no license data for account " << clientInfo.accountName << std::endl;
+        return;
+    }
+
+    std::unordered_set<SteamBot::AppID> seen;
+    CLI::Helpers::forEachLicensedApp(*gameInfo.licenses, [&](const CLI::Helpers::LicenseInfo& license, SteamBot::AppID appId) {
+        if (!seen.insert(appId).second)
+        {
+            return;
+        }
+
+        std::string playtime, lastPlayed;
+        if (gameInfo.ownedGames)
+        {
+            if (auto info=gameInfo.ownedGames->getInfo(appId))
+            {
+                playtime=std::to_string(info->playtimeForever.count());
+                if (info->lastPlayed!=decltype(info->lastPlayed)())
+                {
+                    lastPlayed=std::to_string(std::chrono::duration_cast<std::chrono::seconds>(info->lastPlayed.time_since_epoch()).count());
+                }
+            }
+        }
+
+        std::string cardsEarned, cardsReceived;
+        if (gameInfo.badgeData)
+        {
+            auto iterator=gameInfo.badgeData->badges.find(appId);
+            if (iterator!=gameInfo.badgeData->badges.end())
+            {
+                cardsEarned=std::to_string(iterator->second.cardsEarned);
+                cardsReceived=std::to_string(iterator->second.cardsReceived);
+            }
+        }
+
+        writer.line({
+                clientInfo.accountName,
+                std::to_string(SteamBot::toInteger(appId)),
+                SteamBot::enumToStringAlways(SteamBot::AppInfo::getAppType(appId)),
+                CLI::Helpers::getAppName(appId),
+                std::to_string(SteamBot::toInteger(license.packageId)),
+                playtime, lastPlayed,
+                cardsEarned, cardsReceived
+            });
+    });
+}
+
+/************************************************************************/
+
+void ExportLibraryCommand::Execute::execute(SteamBot::ClientInfo*) const
+{
+    const auto clients=CLI::Helpers::expandAccountNames(accounts);
+    if (clients.empty())
+    {
+        return;
+    }
+
+    std::ofstream stream(filename, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!stream)
+    {
+        std::cout << "can't open \"" << filename << "\"" << std::endl;
+        return;
+    }
+
+    size_t exported=0;
+    Writer writer(stream);
+    writer.line({ "account", "appId", "type", "name", "packageId", "playtime", "lastPlayed", "cardsEarned", "cardsReceived" });
+    for (const auto clientInfo : clients)
+    {
+        if (clientInfo->getClient())
+        {
+            const auto lines=writer.lines;
+            exportAccount(writer, *clientInfo);
+            writer.flush();
+            std::cout << clientInfo->accountName << ": " << writer.lines-lines << " apps" << std::endl;
+            exported++;
+        }
+        else
+        {
+            std::cout << "account \"" << clientInfo->accountName << "\" is not running; skipping" << std::endl;
+        }
+    }
+
+    if (!stream)
+    {
+        std::cout << "error writing \"" << filename << "\"" << std::endl;
+    }
+    else
+    {
+        std::cout << "exported " << exported << " accounts to \"" << filename << "\"" << std::endl;
+    }
+}
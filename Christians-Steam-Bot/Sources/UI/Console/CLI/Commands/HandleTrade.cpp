@@ -22,8 +22,11 @@
 #include "../Helpers.hpp"
 
 #include "Modules/Executor.hpp"
+#include "Modules/TradeOffers.hpp"
 #include "AcceptTrade.hpp"
 
+#include <boost/fiber/operations.hpp>
+
 /************************************************************************/
 
 namespace
@@ -37,9 +40,13 @@ namespace
         static constexpr char offerDesc[]="tradeoffer to accept";
 
         static constexpr ActionFunction action=&SteamBot::acceptTrade;
+        static constexpr bool incoming=true;
+        static constexpr bool allowAll=false;		// we only bulk-accept gifts
+        static constexpr bool allowOnlyAsking=false;
+        static constexpr bool confirmBulk=true;
 
         static constexpr char success[]="accepted";
-        static constexpr char failure[]="accept";
+        static constexpr char verb[]="accept";
     };
 
     struct DeclineInfo
@@ -49,9 +56,13 @@ namespace
         static constexpr char offerDesc[]="tradeoffer to decline";
 
         static constexpr ActionFunction action=&SteamBot::declineTrade;
+        static constexpr bool incoming=true;
+        static constexpr bool allowAll=true;
+        static constexpr bool allowOnlyAsking=true;
+        static constexpr bool confirmBulk=false;
 
         static constexpr char success[]="declined";
-        static constexpr char failure[]="decline";
+        static constexpr char verb[]="decline";
     };
 
     struct CancelInfo
@@ -61,9 +72,13 @@ namespace
         static constexpr char offerDesc[]="tradeoffer to cancel";
 
         static constexpr ActionFunction action=&SteamBot::cancelTrade;
+        static constexpr bool incoming=false;
+        static constexpr bool allowAll=true;
+        static constexpr bool allowOnlyAsking=false;
+        static constexpr bool confirmBulk=false;
 
         static constexpr char success[]="cancelled";
-        static constexpr char failure[]="cancele";
+        static constexpr char verb[]="cancel";
     };
 }
 
@@ -99,15 +114,50 @@ namespace
             return INFO::description;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
         virtual const boost::program_options::options_description* options() const override
         {
             static auto const options=[this](){
                 auto options_=new boost::program_options::options_description();
                 options_->add_options()
                     ("tradeoffer",
-                     boost::program_options::value<SteamBot::TradeOfferID>()->value_name("tradeoffer-id")->required(),
+                     boost::program_options::value<SteamBot::TradeOfferID>()->value_name("tradeoffer-id"),
                      INFO::offerDesc)
+                    ("only-gifts",
+                     boost::program_options::bool_switch(),
+                     "trade offers where I don't give any items")
+                    ("dry-run",
+                     boost::program_options::bool_switch(),
+                     "only list the trade offers")
                     ;
+                if constexpr (INFO::allowAll)
+                {
+                    options_->add_options()
+                        ("all",
+                         boost::program_options::bool_switch(),
+                         "all trade offers")
+                        ;
+                }
+                if constexpr (INFO::allowOnlyAsking)
+                {
+                    options_->add_options()
+                        ("only-asking",
+                         boost::program_options::bool_switch(),
+                         "trade offers where I don't get any items")
+                        ;
+                }
+                if constexpr (INFO::confirmBulk)
+                {
+                    options_->add_options()
+                        ("yes",
+                         boost::program_options::bool_switch(),
+                         "really handle the selected trade offers")
+                        ;
+                }
                 return options_;
             }();
             return options;
@@ -119,20 +169,51 @@ namespace
         private:
             SteamBot::TradeOfferID tradeofferId=SteamBot::TradeOfferID::None;
 
+            bool all=false;
+            bool onlyGifts=false;
+            bool onlyAsking=false;
+            bool dryRun=false;
+
         public:
             using ExecuteBase::ExecuteBase;
 
             virtual ~Execute() =default;
 
+        private:
+            bool isSelected(const SteamBot::TradeOffers::TradeOffer&) const;
+            void executeBulk(SteamBot::ClientInfo&) const;
+
         public:
             virtual bool init(const boost::program_options::variables_map& options) override
             {
-                tradeofferId=options["tradeoffer"].as<SteamBot::TradeOfferID>();
-                return true;
+                all=(INFO::allowAll && options["all"].as<bool>());
+                onlyGifts=options["only-gifts"].as<bool>();
+                onlyAsking=(INFO::allowOnlyAsking && options["only-asking"].as<bool>());
+                dryRun=options["dry-run"].as<bool>();
+                const bool yes=(INFO::confirmBulk && options["yes"].as<bool>());
+
+                const bool bulk=(all || onlyGifts || onlyAsking);
+                if (options.count("tradeoffer"))
+                {
+                    tradeofferId=options["tradeoffer"].as<SteamBot::TradeOfferID>();
+                    return !bulk && !dryRun && !yes;
+                }
+                if (bulk && INFO::confirmBulk && !dryRun && !yes)
+                {
+                    std::cout << INFO::command << ": use --dry-run to check the selected trade offers, then --yes to " << INFO::verb << " them" << std::endl;
+                    return false;
+                }
+                return bulk;
             }
 
             virtual void execute(SteamBot::ClientInfo* clientInfo) const override
             {
+                if (tradeofferId==SteamBot::TradeOfferID::None)
+                {
+                    executeBulk(*clientInfo);
+                    return;
+                }
+
                 bool success=false;
                 if (auto client=clientInfo->getClient())
                 {
@@ -146,7 +227,7 @@ namespace
                 }
                 else
                 {
-                    std::cout << "failed to " << INFO::failure << " trade " << toInteger(tradeofferId) << std::endl;
+                    std::cout << "failed to " << INFO::verb << " trade " << toInteger(tradeofferId) << std::endl;
                 }
             }
         };
@@ -161,3 +242,103 @@ namespace
     SteamBot::UI::CommandBase::Init<TradeCommand<DeclineInfo>> initDecline;
     SteamBot::UI::CommandBase::Init<TradeCommand<CancelInfo>> initCancel;
 }
+
+/************************************************************************/
+
+template <typename INFO> bool TradeCommand<INFO>::Execute::isSelected(const SteamBot::TradeOffers::TradeOffer& offer) const
+{
+    if (onlyGifts && !offer.myItems.empty())
+    {
+        return false;
+    }
+    if (onlyAsking && !offer.theirItems.empty())
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+
+static unsigned int countItems(const std::vector<std::shared_ptr<SteamBot::TradeOffers::TradeOffer::Item>>& items)
+{
+    unsigned int count=0;
+    for (const auto& item : items)
+    {
+        count+=item->amount;
+    }
+    return count;
+}
+
+/************************************************************************/
+/*
+ * All selected offers of the account are handled in one go on the
+ * client, with a pause between the requests so we don't hammer
+ * Steam. The summary is printed when we're done.
+ */
+
+template <typename INFO> void TradeCommand<INFO>::Execute::executeBulk(SteamBot::ClientInfo& clientInfo) const
+{
+    static constexpr std::chrono::seconds delay{1};
+
+    if (auto client=clientInfo.getClient())
+    {
+        bool success=SteamBot::Modules::Executor::executeWithFiber(client, [self=this->template shared_from_this<Execute>(), accountName=clientInfo.accountName](SteamBot::Client&) {
+            auto offers=(INFO::incoming ? SteamBot::TradeOffers::getIncoming() : SteamBot::TradeOffers::getOutgoing());
+
+            std::vector<const SteamBot::TradeOffers::TradeOffer*> selected;
+            if (offers)
+            {
+                for (const auto& offer : offers->offers)
+                {
+                    if (self->isSelected(*(offer.second)))
+                    {
+                        selected.push_back(offer.second.get());
+                    }
+                }
+            }
+
+            if (self->dryRun)
+            {
+                SteamBot::UI::OutputText output;
+                output << accountName << ": " << selected.size() << " trade offers to " << INFO::verb;
+                for (const auto offer : selected)
+                {
+                    output << "\n   id " << toInteger(offer->tradeOfferId)
+                           << (INFO::incoming ? " from " : " to ") << SteamBot::ClientInfo::prettyName(offer->partner)
+                           << ": I give " << countItems(offer->myItems) << " items, I get " << countItems(offer->theirItems) << " items";
+                }
+                return;
+            }
+
+            unsigned int succeeded=0;
+            std::vector<SteamBot::TradeOfferID> failed;
+            for (size_t i=0; i<selected.size(); i++)
+            {
+                if (i>0)
+                {
+                    boost::this_fiber::sleep_for(delay);
+                }
+                if ((*INFO::action)(selected[i]->tradeOfferId))
+                {
+                    succeeded++;
+                }
+                else
+                {
+                    failed.push_back(selected[i]->tradeOfferId);
+                }
+            }
+
+            SteamBot::UI::OutputText output;
+            output << accountName << ": " << INFO::success << " " << succeeded << " of " << selected.size() << " trade offers";
+            for (const auto tradeOfferId : failed)
+            {
+                output << "\n   failed to " << INFO::verb << " trade " << toInteger(tradeOfferId);
+            }
+        });
+        if (success)
+        {
+            std::cout << "requested bulk " << INFO::command << " for account " << clientInfo.accountName << std::endl;
+        }
+    }
+}
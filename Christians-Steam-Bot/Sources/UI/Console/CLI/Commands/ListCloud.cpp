@@ -20,11 +20,13 @@
 #include "UI/CLI.hpp"
 #include "UI/Command.hpp"
 
+#include "../Helpers.hpp"
+
 #include "Client/Client.hpp"
 #include "Modules/Executor.hpp"
 #include "Cloud.hpp"
+#include "UI/Sort.hpp"
 #include "Vector.hpp"
-#include "Helpers/StringCompare.hpp"
 #include "Helpers/NumberString.hpp"
 #include "EnumString.hpp"
 
@@ -72,10 +74,13 @@ namespace
                      "games to list")
                     ("size",
                      boost::program_options::bool_switch(),
-                     "sort by total size")
+                     "sort by total size, largest first")
                     ("count",
                      boost::program_options::bool_switch(),
-                     "sort by file count")
+                     "sort by file count, largest first")
+                    ("limit",
+                     boost::program_options::value<unsigned int>()->value_name("count"),
+                     "only list the first games")
                     ;
                 return options_;
             }();
@@ -89,6 +94,7 @@ namespace
             std::optional<SteamBot::OptionRegexID> gamesRegex;
             bool sortSize=false;
             bool sortCount=false;
+            size_t limit=std::numeric_limits<size_t>::max();
 
         private:
             void filterApps(SteamBot::Cloud::Apps&) const;
@@ -108,6 +114,10 @@ namespace
                 {
                     gamesRegex=options["games"].as<SteamBot::OptionRegexID>();
                 }
+                if (options.count("limit"))
+                {
+                    limit=options["limit"].as<unsigned int>();
+                }
                 return true;
             }
 
@@ -140,33 +150,25 @@ void ListCloudCommand::Execute::filterApps(SteamBot::Cloud::Apps& apps) const
 void ListCloudCommand::Execute::sortApps(SteamBot::Cloud::Apps& apps) const
 {
     typedef SteamBot::Cloud::Apps::App App;
-    bool(*compare)(const App&, const App&)=nullptr;
 
-    if (sortSize)
-    {
-        compare=[](const App& left, const App& right) {
-            return left.totalSize<right.totalSize;
-        };
-    }
-    else if (sortCount)
-    {
-        compare=[](const App& left, const App& right) {
-            return left.totalCount<right.totalCount;
-        };
-    }
-    else
-    {
-        compare=[](const App& left, const App& right) {
-            return SteamBot::caseInsensitiveStringCompare_less(left.name, right.name);
-        };
-    }
-
-    std::sort(apps.apps.begin(), apps.apps.end(), compare);
+    // largest first, so --limit gives the top games
+    SteamBot::UI::sortItems(apps.apps, [this](const App& app) {
+        int64_t first=0;
+        if (sortSize)
+        {
+            first=-static_cast<int64_t>(app.totalSize);
+        }
+        else if (sortCount)
+        {
+            first=-static_cast<int64_t>(app.totalCount);
+        }
+        return std::make_tuple(first, SteamBot::UI::makeSortKey(app.name));
+    }, limit);
 }
 
 /************************************************************************/
 
-static void printApps(const SteamBot::Cloud::Apps& apps)
+static void printApps(const SteamBot::Cloud::Apps& apps, size_t matching)
 {
     uint32_t totalCount=0;
     uint64_t totalSize=0;
@@ -184,7 +186,12 @@ static void printApps(const SteamBot::Cloud::Apps& apps)
         totalSize+=app.totalSize;
     }
 
-    std::cout << "listed " << apps.apps.size() << " games with " << totalCount << " files using " << SteamBot::printSize(totalSize) << '\n';
+    std::cout << "listed " << apps.apps.size() << " games with " << totalCount << " files using " << SteamBot::printSize(totalSize);
+    if (apps.apps.size()<matching)
+    {
+        std::cout << "; " << matching << " games matched";
+    }
+    std::cout << '\n';
 }
 
 /************************************************************************/
@@ -193,13 +200,18 @@ void ListCloudCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
 {
     if (auto client=clientInfo->getClient())
     {
-        SteamBot::Cloud::Apps apps;
-        SteamBot::Modules::Executor::execute(client, [&apps](SteamBot::Client&) mutable {
-            apps.load();
+        auto apps=cli.helpers->execute(std::move(client), [](SteamBot::Client&) {
+            SteamBot::Cloud::Apps apps_;
+            apps_.load();
+            return apps_;
         });
 
-        filterApps(apps);
-        sortApps(apps);
-        printApps(apps);
+        if (apps)
+        {
+            filterApps(*apps);
+            const size_t matching=apps->apps.size();
+            sortApps(*apps);
+            printApps(*apps, matching);
+        }
     }
 }
@@ -19,16 +19,17 @@
 
 #include "UI/CLI.hpp"
 #include "UI/Command.hpp"
+#include "UI/Sort.hpp"
 
 #include "../Helpers.hpp"
 
 #include "Client/Client.hpp"
-#include "Helpers/StringCompare.hpp"
 #include "Helpers/Time.hpp"
 #include "Helpers/JSON.hpp"
 #include "Modules/PackageData.hpp"
 #include "Modules/PackageInfo.hpp"
 #include "EnumString.hpp"
+#include "Vector.hpp"
 #include "AppInfo.hpp"
 #include "Steam/AppType.hpp"
 
@@ -93,10 +94,10 @@ namespace
                      "games to list")
                     ("playtime",
                      boost::program_options::bool_switch(),
-                     "sort by playtime")
+                     "sort by playtime, most played first")
                     ("last-played",
                      boost::program_options::bool_switch(),
-                     "sort by last played")
+                     "sort by last played, most recent first")
                     ("no-dlc",
                      boost::program_options::bool_switch(),
                      "don't list DLCs")
@@ -112,6 +113,12 @@ namespace
                     ("farmable",
                      boost::program_options::bool_switch(),
                      "only list games with remaining card drops")
+                    ("missing-dlc",
+                     boost::program_options::bool_switch(),
+                     "only list games with DLCs that you don't own")
+                    ("limit",
+                     boost::program_options::value<unsigned int>()->value_name("count"),
+                     "only list the first games")
                     ;
                 return options_;
             }();
@@ -130,6 +137,8 @@ namespace
             bool sortPlaytime=false;
             bool sortLastPlayed=false;
             bool noDLC=false;
+            bool missingDLC=false;
+            size_t limit=std::numeric_limits<size_t>::max();
 
         public:
             using ExecuteBase::ExecuteBase;
@@ -157,12 +166,14 @@ namespace
                 unsigned int earlyAccess=0;
                 unsigned int adult=0;
                 unsigned int DLC=0;
+                unsigned int missingDLC=0;
                 unsigned int nonGame=0;
             };
 
         private:
             bool printAdult(const GameItem&) const;
             void printFlags(const GameItem&, Totals &) const;
+            std::optional<GameItem> makeGameItem(const CLI::Helpers::GameInfo&, SteamBot::AppID, bool) const;
             std::vector<GameItem> createGameList(const CLI::Helpers::GameInfo&) const;
             void sortGameList(std::vector<GameItem>&) const;
             void outputGameList(SteamBot::ClientInfo&, const CLI::Helpers::GameInfo&) const;
@@ -171,6 +182,7 @@ namespace
             virtual bool init(const boost::program_options::variables_map& options) override
             {
                 noDLC=options["no-dlc"].as<bool>();
+                missingDLC=options["missing-dlc"].as<bool>();
                 family=options["family"].as<bool>();
                 adult=options["adult"].as<bool>();
                 earlyAccess=options["early-access"].as<bool>();
@@ -181,6 +193,10 @@ namespace
                 {
                     gamesRegex=options["games"].as<SteamBot::OptionRegexID>();
                 }
+                if (options.count("limit"))
+                {
+                    limit=options["limit"].as<unsigned int>();
+                }
                 return true;
             }
 
@@ -240,126 +256,131 @@ bool ListGamesCommand::Execute::printAdult(const  ListGamesCommand::Execute::Gam
 
 /************************************************************************/
 
-std::vector<ListGamesCommand::Execute::GameItem> ListGamesCommand::Execute::createGameList(const CLI::Helpers::GameInfo& gameInfo) const
+/*
+ * Returns an item for the app, or nothing if it's filtered out.
+ */
+
+std::optional<ListGamesCommand::Execute::GameItem> ListGamesCommand::Execute::makeGameItem(const CLI::Helpers::GameInfo& gameInfo, SteamBot::AppID appId, bool notFamily) const
 {
-    std::unordered_map<SteamBot::AppID, bool /* not family */> appIds;
-    for (const auto &license : gameInfo.licenses->licenses)
+    if (family && notFamily)
     {
-        if (auto package=SteamBot::Modules::PackageData::getPackageInfo(*(license.second)))
-        {
-            for (auto appId: package->appIds)
-            {
-                appIds[appId]|=(license.second->paymentMethod!=SteamBot::PaymentMethod::FamilyGroup);
-            }
-        }
+        return std::nullopt;
     }
 
-    std::vector<GameItem> games;
-    for (auto appId : appIds)
-    {
-        if (family && appId.second)
-        {
-            continue;
-        }
-
-        GameItem item;
+    GameItem item;
 
-        item.appId=appId.first;
-        item.family=!appId.second;
+    item.appId=appId;
+    item.family=!notFamily;
 
-        item.appType=SteamBot::AppInfo::getAppType(item.appId);
-        if (item.appType==SteamBot::AppType::DLC)
-        {
-            continue;
-        }
+    item.appType=SteamBot::AppInfo::getAppType(item.appId);
+    if (item.appType==SteamBot::AppType::DLC)
+    {
+        return std::nullopt;
+    }
 
-        item.earlyAccess=SteamBot::AppInfo::isEarlyAccess(item.appId);
-        if (earlyAccess && !item.earlyAccess)
-        {
-            continue;
-        }
+    item.earlyAccess=SteamBot::AppInfo::isEarlyAccess(item.appId);
+    if (earlyAccess && !item.earlyAccess)
+    {
+        return std::nullopt;
+    }
 
-        if (auto json=SteamBot::AppInfo::get(item.appId, "common", "content_descriptors"))
+    if (auto json=SteamBot::AppInfo::get(item.appId, "common", "content_descriptors"))
+    {
+        if (auto descriptors=json->if_object())
         {
-            if (auto descriptors=json->if_object())
+            if (!descriptors->empty())
             {
-                if (!descriptors->empty())
-                {
-                    item.adult.emplace(std::move(*descriptors));
-                }
+                item.adult.emplace(std::move(*descriptors));
             }
         }
-        if (adult && !item.adult)
-        {
-            continue;
-        }
+    }
+    if (adult && !item.adult)
+    {
+        return std::nullopt;
+    }
 
-        if (farmable)
+    if (farmable)
+    {
+        bool isFarmable=false;
+        if (auto badgeData=gameInfo.badgeData.get())
         {
-            bool isFarmable=false;
-            if (auto badgeData=gameInfo.badgeData.get())
+            auto iterator=badgeData->badges.find(item.appId);
+            if (iterator!=badgeData->badges.end())
             {
-                auto iterator=badgeData->badges.find(item.appId);
-                if (iterator!=badgeData->badges.end())
+                if (iterator->second.cardsReceived<iterator->second.cardsEarned)
                 {
-                    if (iterator->second.cardsReceived<iterator->second.cardsEarned)
-                    {
-                        isFarmable=true;
-                    }
+                    isFarmable=true;
                 }
             }
-            if (!isFarmable)
-            {
-                continue;
-            }
         }
-
-        if (auto json=SteamBot::AppInfo::get(item.appId, "common", "name"))
+        if (!isFarmable)
         {
-            if (auto string=json->if_string())
-            {
-                item.name=std::move(*string);
-            }
-        }
-        if (gamesRegex && ! gamesRegex->doesMatch(item.name, item.appId))
-        {
-            continue;
+            return std::nullopt;
         }
+    }
 
-        if (gameInfo.ownedGames)
-        {
-            item.gameInfo=gameInfo.ownedGames->getInfo(item.appId);
-        }
+    item.name=CLI::Helpers::getAppName(item.appId);
+    if (gamesRegex && ! gamesRegex->doesMatch(item.name, item.appId))
+    {
+        return std::nullopt;
+    }
 
-        games.emplace_back(std::move(item));
+    if (gameInfo.ownedGames)
+    {
+        item.gameInfo=gameInfo.ownedGames->getInfo(item.appId);
     }
 
-    return games;
+    return item;
 }
 
 /************************************************************************/
+/*
+ * First we expand the licenses into apps, then we filter the apps
+ * and turn them into items.
+ */
 
-void ListGamesCommand::Execute::sortGameList(std::vector<ListGamesCommand::Execute::GameItem> &games) const
+std::vector<ListGamesCommand::Execute::GameItem> ListGamesCommand::Execute::createGameList(const CLI::Helpers::GameInfo& gameInfo) const
 {
-    std::sort(games.begin(), games.end(), [this](const GameItem& left, const GameItem& right) -> bool {
-        static const OwnedGames::GameInfo empty;
-        const auto& l=left.gameInfo ? *(left.gameInfo) : empty;
-        const auto& r=right.gameInfo ? *(right.gameInfo) : empty;
+    std::unordered_map<SteamBot::AppID, bool /* not family */> appIds;
+    CLI::Helpers::forEachLicensedApp(*gameInfo.licenses, [&appIds](const CLI::Helpers::LicenseInfo& license, SteamBot::AppID appId) {
+        appIds[appId]|=(license.paymentMethod!=SteamBot::PaymentMethod::FamilyGroup);
+    });
 
-        if (sortPlaytime)
+    std::vector<GameItem> games;
+    for (const auto& app : appIds)
+    {
+        if (auto item=makeGameItem(gameInfo, app.first, app.second))
         {
-            auto compare=(l.playtimeForever<=>r.playtimeForever);
-            if (compare==std::strong_ordering::less) return true;
-            if (compare==std::strong_ordering::greater) return false;
+            games.emplace_back(std::move(*item));
         }
-        else if (sortLastPlayed)
+    }
+    return games;
+}
+
+/************************************************************************/
+
+/*
+ * Playtime and last-played sort the largest values first, so --limit
+ * gives the top games.
+ */
+
+void ListGamesCommand::Execute::sortGameList(std::vector<ListGamesCommand::Execute::GameItem> &games) const
+{
+    SteamBot::UI::sortItems(games, [this](const GameItem& game) {
+        int64_t first=0;
+        if (game.gameInfo)
         {
-            auto compare=(l.lastPlayed<=>r.lastPlayed);
-            if (compare==std::strong_ordering::less) return true;
-            if (compare==std::strong_ordering::greater) return false;
+            if (sortPlaytime)
+            {
+                first=-static_cast<int64_t>(game.gameInfo->playtimeForever.count());
+            }
+            else if (sortLastPlayed)
+            {
+                first=-static_cast<int64_t>(game.gameInfo->lastPlayed.time_since_epoch().count());
+            }
         }
-        return SteamBot::caseInsensitiveStringCompare_less(left.name, right.name);
-    });
+        return std::make_tuple(first, SteamBot::UI::makeSortKey(game.name));
+    }, limit);
 }
 
 /************************************************************************/
@@ -404,7 +425,16 @@ void ListGamesCommand::Execute::printFlags(const ListGamesCommand::Execute::Game
 void ListGamesCommand::Execute::outputGameList(SteamBot::ClientInfo& clientInfo, const CLI::Helpers::GameInfo& gameInfo) const
 {
     auto games=createGameList(gameInfo);
+    const auto dlcIndex=cli.helpers->getDLCIndex(clientInfo, gameInfo.licenses);
 
+    if (missingDLC)
+    {
+        SteamBot::erase(games, [&dlcIndex](const GameItem& game) {
+            return dlcIndex->getMissingDLCs(game.appId).empty();
+        });
+    }
+
+    const size_t matching=games.size();
     sortGameList(games);
 
     Totals totals;
@@ -434,19 +464,26 @@ void ListGamesCommand::Execute::outputGameList(SteamBot::ClientInfo& clientInfo,
             }
         }
 
+        for (auto appId: dlcIndex->getOwnedDLCs(game.appId))
+        {
+            if (!noDLC)
+            {
+                std::cout << "\n          (DLC) " << appId;
+            }
+            totals.DLC++;
+        }
+
+        if (missingDLC)
         {
-            auto DLCs=SteamBot::AppInfo::getDLCs(game.appId);
-            for (auto appId: DLCs)
+            for (auto appId: dlcIndex->getMissingDLCs(game.appId))
             {
-                auto licenses=CLI::Helpers::getLicenseInfo(clientInfo, appId);
-                if (!licenses.empty())
+                std::cout << "\n          (missing DLC) " << appId;
+                const auto name=CLI::Helpers::getAppName(appId);
+                if (!name.empty())
                 {
-                    if (!noDLC)
-                    {
-                        std::cout << "\n          (DLC) " << appId;
-                    }
-                    totals.DLC++;
+                    std::cout << ": " << name;
                 }
+                totals.missingDLC++;
             }
         }
 
@@ -479,7 +516,16 @@ void ListGamesCommand::Execute::outputGameList(SteamBot::ClientInfo& clientInfo,
               << totals.adult << " adult, "
               << totals.earlyAccess << " early access) and "
               << totals.DLC << " DLCs, with a total playtime of "
-              << SteamBot::Time::toString(totals.playtime) << "\n";
+              << SteamBot::Time::toString(totals.playtime);
+    if (missingDLC)
+    {
+        std::cout << "; " << totals.missingDLC << " DLCs are missing";
+    }
+    if (games.size()<matching)
+    {
+        std::cout << "; " << matching << " items matched";
+    }
+    std::cout << "\n";
 }
 
 /************************************************************************/
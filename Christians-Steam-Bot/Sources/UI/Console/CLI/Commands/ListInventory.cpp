@@ -19,9 +19,9 @@
 
 #include "UI/CLI.hpp"
 #include "UI/Command.hpp"
+#include "UI/Sort.hpp"
 
 #include "AssetData.hpp"
-#include "Helpers/StringCompare.hpp"
 #include "Modules/Inventory.hpp"
 #include "Modules/Executor.hpp"
 
@@ -55,6 +55,11 @@ namespace
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
         virtual const boost::program_options::options_description* options() const override
         {
             static auto const options=[](){
@@ -140,13 +145,8 @@ void ListInventoryCommand::Execute::outputInventory(const Inventory& inventory)
         }
     }
 
-    std::sort(items.begin(), items.end(), [](const Item& left, const Item& right) -> bool {
-        auto result=SteamBot::caseInsensitiveStringCompare(left.assetInfo->type, right.assetInfo->type);
-        if (result==decltype(result)::equivalent)
-        {
-            result=SteamBot::caseInsensitiveStringCompare(left.assetInfo->name, right.assetInfo->name);
-        }
-        return result==std::weak_ordering::less;
+    SteamBot::UI::sortItems(items, [](const Item& item) {
+        return std::make_pair(SteamBot::UI::makeSortKey(item.assetInfo->type), SteamBot::UI::makeSortKey(item.assetInfo->name));
     });
 
     SteamBot::UI::OutputText output;
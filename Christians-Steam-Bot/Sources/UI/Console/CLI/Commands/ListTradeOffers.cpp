@@ -49,6 +49,11 @@ namespace
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
     public:
         class Execute : public ExecuteBase
         {
@@ -20,6 +20,7 @@
 #include "UI/CLI.hpp"
 #include "UI/Command.hpp"
 #include "../Helpers.hpp"
+#include "../ResponseCache.hpp"
 
 #include "Modules/Executor.hpp"
 #include "Modules/WebSession.hpp"
@@ -69,6 +70,9 @@ namespace
                     ("url",
                      boost::program_options::value<SteamBot::OptionURL>()->value_name("url"),
                      "page url")
+                    ("cache",
+                     boost::program_options::bool_switch(),
+                     "use the response cache")
                     ;
                 return options_;
             }();
@@ -80,6 +84,7 @@ namespace
         {
         private:
             SteamBot::OptionURL url;
+            bool cache=false;
 
         public:
             using ExecuteBase::ExecuteBase;
@@ -89,6 +94,7 @@ namespace
         public:
             virtual bool init(const boost::program_options::variables_map& options) override
             {
+                cache=options["cache"].as<bool>();
                 if (options.count("url"))
                 {
                     url=options["url"].as<SteamBot::OptionURL>();
@@ -97,32 +103,45 @@ namespace
                 return false;
             }
 
-            bool loadURL() const
+            SteamBot::UI::ResponseCache::Result loadURL(const SteamBot::ClientInfo& clientInfo) const
             {
                 typedef SteamBot::Modules::WebSession::Messageboard::Request Request;
 
                 auto request=std::make_shared<Request>();
-                request->queryMaker=[this](){
-                    return std::make_unique<SteamBot::HTTPClient::Query>(boost::beast::http::verb::get, url);
+                request->queryMaker=[this, &clientInfo](){
+                    auto query=std::make_unique<SteamBot::HTTPClient::Query>(boost::beast::http::verb::get, url);
+                    if (cache)
+                    {
+                        SteamBot::UI::ResponseCache::get().prepare(clientInfo, url.buffer(), *query);
+                    }
+                    return query;
                 };
 
                 auto response=SteamBot::Modules::WebSession::makeQuery(std::move(request));
-                if (response->query->response.result()!=boost::beast::http::status::ok)
+                if (cache)
                 {
-                    return false;
+                    return SteamBot::UI::ResponseCache::get().update(clientInfo, url.buffer(), *(response->query));
                 }
-                return true;
+
+                SteamBot::UI::ResponseCache::Result result;
+                result.status=static_cast<unsigned int>(response->query->response.result());
+                return result;
             }
 
             virtual void execute(SteamBot::ClientInfo* clientInfo) const override
             {
                 if (auto client=clientInfo->getClient())
                 {
-                    bool success=false;
-                    SteamBot::Modules::Executor::execute(client, [this, &success](SteamBot::Client&) mutable {
-                        success=loadURL();
+                    SteamBot::UI::ResponseCache::Result result;
+                    SteamBot::Modules::Executor::execute(client, [this, clientInfo, &result](SteamBot::Client&) mutable {
+                        result=loadURL(*clientInfo);
                     });
-                    std::cout << "page load: " << (success ? "success" : "failure") << '\n';
+                    const bool success=(result.status==static_cast<unsigned int>(boost::beast::http::status::ok));
+                    std::cout << "page load: " << (success ? "success" : "failure") << (result.cached ? " (not modified)" : "") << '\n';
+                    if (result.evicted)
+                    {
+                        std::cout << "got \"304 Not Modified\", but the page was dropped from the cache in the meantime; try again" << '\n';
+                    }
                 }
             }
         };
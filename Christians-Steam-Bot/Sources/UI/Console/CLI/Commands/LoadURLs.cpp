@@ -0,0 +1,421 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+#include "UI/Table.hpp"
+#include "../Helpers.hpp"
+#include "../ResponseCache.hpp"
+
+#include "Modules/Executor.hpp"
+#include "Modules/WebSession.hpp"
+#include "ExecuteFibers.hpp"
+#include "Helpers/NumberString.hpp"
+
+#include <fstream>
+#include <map>
+#include <algorithm>
+#include <cassert>
+
+/************************************************************************/
+/*
+ * Loads a bunch of URLs on one account, with a limited number of
+ * requests running at the same time, and reports some numbers
+ * per host. This runs in the background, like clear-queue, since
+ * a long list can take a while.
+ */
+
+/************************************************************************/
+
+namespace
+{
+    class LoadURLsCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        LoadURLsCommand() =default;
+
+    public:
+        virtual bool global() const
+        {
+            return false;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("load-urls");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("load several webpages and report timings");
+            return string;
+        }
+
+        virtual bool background() const override
+        {
+            return true;
+        }
+
+        virtual const boost::program_options::positional_options_description* positionals() const override
+        {
+            static auto const positional=[](){
+                auto positional_=new boost::program_options::positional_options_description();
+                positional_->add("urls", -1);
+                return positional_;
+            }();
+            return positional;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("urls",
+                     boost::program_options::value<std::vector<std::string>>()->multitoken(),
+                     "page urls")
+                    ("file",
+                     boost::program_options::value<std::string>()->value_name("filename"),
+                     "read urls from a file, one per line")
+                    ("concurrency",
+                     boost::program_options::value<unsigned int>()->value_name("count")->default_value(4),
+                     "number of pages to load at the same time")
+                    ("cache",
+                     boost::program_options::bool_switch(),
+                     "use the response cache")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+    public:
+        class Execute : public ExecuteBase
+        {
+        public:
+            struct Result
+            {
+                std::string host;
+                unsigned int status=0;
+                size_t bytes=0;
+                std::chrono::steady_clock::duration duration{0};
+                bool cached=false;
+            };
+
+        private:
+            std::vector<boost::urls::url> urls;
+            unsigned int concurrency=4;
+            bool cache=false;
+
+        public:
+            using ExecuteBase::ExecuteBase;
+
+            virtual ~Execute() =default;
+
+        private:
+            bool addURL(const std::string&);
+            Result loadURL(const SteamBot::ClientInfo&, const boost::urls::url&) const;
+            std::vector<Result> loadURLs(const SteamBot::ClientInfo&) const;
+            void printResults(SteamBot::UI::OutputText&, std::vector<Result>) const;
+
+        public:
+            virtual bool init(const boost::program_options::variables_map& options) override
+            {
+                concurrency=std::max(1u, options["concurrency"].as<unsigned int>());
+                cache=options["cache"].as<bool>();
+
+                if (options.count("urls"))
+                {
+                    for (const auto& url : options["urls"].as<std::vector<std::string>>())
+                    {
+                        if (!addURL(url))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                if (options.count("file"))
+                {
+                    const auto& filename=options["file"].as<std::string>();
+                    std::ifstream file(filename);
+                    if (!file)
+                    {
+                        std::cout << "can't open \"" << filename << "\"" << std::endl;
+                        return false;
+                    }
+
+                    std::string line;
+                    while (std::getline(file, line))
+                    {
+                        while (!line.empty() && (line.back()=='\r' || line.back()==' '))
+                        {
+                            line.pop_back();
+                        }
+                        if (!line.empty() && line.front()!='#')
+                        {
+                            if (!addURL(line))
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                }
+
+                return !urls.empty();
+            }
+
+            virtual void execute(SteamBot::ClientInfo* clientInfo) const override;
+        };
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
+        {
+            return std::make_shared<Execute>(cli);
+        }
+    };
+
+    LoadURLsCommand::Init<LoadURLsCommand> init;
+}
+
+/************************************************************************/
+
+typedef LoadURLsCommand::Execute::Result Result;
+
+/************************************************************************/
+
+bool LoadURLsCommand::Execute::addURL(const std::string& string)
+{
+    try
+    {
+        urls.emplace_back(string);
+        return true;
+    }
+    catch(const boost::system::system_error&)
+    {
+        std::cout << "invalid url: " << string << std::endl;
+        return false;
+    }
+}
+
+/************************************************************************/
+/*
+ * Runs on the client thread.
+ *
+ * A status of 0 means that we didn't get a response at all. We're
+ * running in one of the loadURLs() fibers, so nothing may escape.
+ */
+
+Result LoadURLsCommand::Execute::loadURL(const SteamBot::ClientInfo& clientInfo, const boost::urls::url& url) const
+{
+    typedef SteamBot::Modules::WebSession::Messageboard::Request Request;
+
+    Result result;
+    result.host=std::string(url.host());
+
+    auto request=std::make_shared<Request>();
+    request->queryMaker=[this, &clientInfo, &url](){
+        auto query=std::make_unique<SteamBot::HTTPClient::Query>(boost::beast::http::verb::get, url);
+        if (cache)
+        {
+            SteamBot::UI::ResponseCache::get().prepare(clientInfo, url.buffer(), *query);
+        }
+        return query;
+    };
+
+    const auto start=std::chrono::steady_clock::now();
+    try
+    {
+        auto response=SteamBot::Modules::WebSession::makeQuery(std::move(request));
+        if (cache)
+        {
+            const auto cached=SteamBot::UI::ResponseCache::get().update(clientInfo, url.buffer(), *(response->query));
+            result.status=cached.status;
+            result.bytes=cached.bytes;
+            result.cached=cached.cached;
+        }
+        else
+        {
+            result.status=static_cast<unsigned int>(response->query->response.result());
+            result.bytes=response->query->response.body().size();
+        }
+    }
+    catch(...)
+    {
+    }
+    result.duration=std::chrono::steady_clock::now()-start;
+
+    return result;
+}
+
+/************************************************************************/
+/*
+ * Runs on the client thread.
+ *
+ * Each fiber takes the next URL from the list until we're done, so
+ * there are never more than "concurrency" requests in flight.
+ */
+
+std::vector<Result> LoadURLsCommand::Execute::loadURLs(const SteamBot::ClientInfo& clientInfo) const
+{
+    std::vector<Result> results(urls.size());
+    size_t next=0;
+
+    {
+        SteamBot::ExecuteFibers fibers;
+        for (unsigned int i=0; i<concurrency && i<urls.size(); i++)
+        {
+            fibers.run([this, &clientInfo, &results, &next](){
+                while (next<urls.size())
+                {
+                    const size_t index=next++;
+                    results[index]=loadURL(clientInfo, urls[index]);
+                }
+            });
+        }
+    }
+
+    return results;
+}
+
+/************************************************************************/
+/*
+ * Nearest-rank percentile; the durations must be sorted.
+ */
+
+static std::chrono::steady_clock::duration getPercentile(const std::vector<std::chrono::steady_clock::duration>& durations, unsigned int percent)
+{
+    assert(!durations.empty());
+    size_t rank=(durations.size()*percent+99)/100;
+    if (rank>0)
+    {
+        rank--;
+    }
+    return durations[rank];
+}
+
+/************************************************************************/
+
+static std::string printMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count())+"ms";
+}
+
+/************************************************************************/
+
+void LoadURLsCommand::Execute::printResults(SteamBot::UI::OutputText& output, std::vector<Result> results) const
+{
+    struct Host
+    {
+        std::map<unsigned int, unsigned int> status;
+        unsigned int cached=0;
+        size_t bytes=0;
+        std::vector<std::chrono::steady_clock::duration> durations;
+    };
+
+    std::map<std::string, Host> hosts;
+    for (auto& result : results)
+    {
+        auto& host=hosts[std::move(result.host)];
+        host.status[result.status]++;
+        host.bytes+=result.bytes;
+        host.cached+=result.cached;
+        host.durations.push_back(result.duration);
+    }
+
+    enum class Columns : unsigned int { Host, Requests, Status, Cached, Bytes, P50, P90, P99, Max };
+    SteamBot::UI::Table<Columns> table;
+
+    for (auto& item : hosts)
+    {
+        auto& host=item.second;
+        std::sort(host.durations.begin(), host.durations.end());
+
+        decltype(table)::Line line;
+        line[Columns::Host] << item.first;
+        line[Columns::Requests] << host.durations.size();
+        {
+            const char* separator="";
+            for (const auto& status : host.status)
+            {
+                line[Columns::Status] << separator;
+                if (status.first==0)
+                {
+                    line[Columns::Status] << "failed";
+                }
+                else
+                {
+                    line[Columns::Status] << status.first;
+                }
+                line[Columns::Status] << "x" << status.second;
+                separator=" ";
+            }
+        }
+        line[Columns::Cached] << host.cached;
+        line[Columns::Bytes] << SteamBot::printSize(host.bytes);
+        line[Columns::P50] << printMilliseconds(getPercentile(host.durations, 50));
+        line[Columns::P90] << printMilliseconds(getPercentile(host.durations, 90));
+        line[Columns::P99] << printMilliseconds(getPercentile(host.durations, 99));
+        table.add(line);
+    }
+
+    output << "host: requests | status | cached | bytes | p50 | p90 | p99";
+    while (table.startLine())
+    {
+        output << '\n' << table.getContent(Columns::Host) << table.getFiller(Columns::Host);
+        output << " | " << table.getFiller(Columns::Requests) << table.getContent(Columns::Requests);
+        output << " | " << table.getContent(Columns::Status) << table.getFiller(Columns::Status);
+        for (auto column : { Columns::Cached, Columns::Bytes, Columns::P50, Columns::P90, Columns::P99 })
+        {
+            output << " | " << table.getFiller(column) << table.getContent(column);
+        }
+    }
+
+    if (cache)
+    {
+        const auto statistics=SteamBot::UI::ResponseCache::get().getStatistics();
+        output << "\nresponse cache: " << statistics.hits << " hits, " << statistics.misses << " misses";
+        if (statistics.evicted!=0)
+        {
+            output << " (" << statistics.evicted << " were a 304 for a page that had been dropped)";
+        }
+        output << ", "
+               << statistics.entries << " pages using " << SteamBot::printSize(statistics.bytes)
+               << " of " << SteamBot::printSize(statistics.budget);
+    }
+}
+
+/************************************************************************/
+
+void LoadURLsCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
+{
+    if (auto client=clientInfo->getClient())
+    {
+        bool success=SteamBot::Modules::Executor::executeWithFiber(client, [self=shared_from_this<Execute>(), clientInfo](SteamBot::Client&) {
+            auto results=self->loadURLs(*clientInfo);
+            SteamBot::UI::OutputText output;
+            output << clientInfo->accountName << ": loaded " << results.size() << " pages\n";
+            self->printResults(output, std::move(results));
+        });
+        if (success)
+        {
+            std::cout << "requested " << urls.size() << " pages for account " << clientInfo->accountName << std::endl;
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <optional>
+
+/************************************************************************/
+/*
+ * Changes the severity filter of the logging core. The sinks may have
+ * filters of their own; this can only make the log quieter than
+ * those, not louder.
+ */
+
+/************************************************************************/
+
+namespace
+{
+    class LogLevelCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        virtual bool global() const
+        {
+            return true;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("log-level");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("show or change the minimum log level");
+            return string;
+        }
+
+        virtual const boost::program_options::positional_options_description* positionals() const override
+        {
+            static auto const positional=[](){
+                auto positional_=new boost::program_options::positional_options_description();
+                positional_->add("level", 1);
+                return positional_;
+            }();
+            return positional;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("level",
+                     boost::program_options::value<boost::log::trivial::severity_level>()->value_name("trace|debug|info|warning|error|fatal"),
+                     "minimum level of messages to log")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+    public:
+        class Execute : public ExecuteBase
+        {
+        private:
+            std::optional<boost::log::trivial::severity_level> level;
+
+        public:
+            using ExecuteBase::ExecuteBase;
+
+            virtual ~Execute() =default;
+
+        public:
+            virtual bool init(const boost::program_options::variables_map& options) override
+            {
+                if (options.count("level"))
+                {
+                    level=options["level"].as<boost::log::trivial::severity_level>();
+                }
+                return true;
+            }
+
+            virtual void execute(SteamBot::ClientInfo*) const override;
+        };
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
+        {
+            return std::make_shared<Execute>(cli);
+        }
+    };
+
+    LogLevelCommand::Init<LogLevelCommand> init;
+}
+
+/************************************************************************/
+/*
+ * The core doesn't tell us its filter, so we just remember what we
+ * have set.
+ */
+
+static std::optional<boost::log::trivial::severity_level> currentLevel;
+
+/************************************************************************/
+
+void LogLevelCommand::Execute::execute(SteamBot::ClientInfo*) const
+{
+    if (level)
+    {
+        boost::log::core::get()->set_filter(boost::log::trivial::severity>=*level);
+        currentLevel=level;
+        std::cout << "now logging messages of level " << *level << " and above" << std::endl;
+    }
+    else if (currentLevel)
+    {
+        std::cout << "logging messages of level " << *currentLevel << " and above" << std::endl;
+    }
+    else
+    {
+        std::cout << "the log level has not been changed" << std::endl;
+    }
+}
@@ -0,0 +1,275 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+#include "UI/Table.hpp"
+
+#include "../Helpers.hpp"
+
+#include "Client/Client.hpp"
+#include "Helpers/NumberString.hpp"
+
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+
+/************************************************************************/
+/*
+ * All numbers are estimates: we count the objects we can see, plus a
+ * guess for the container overhead. This is meant to find the large
+ * items, not to account for every byte.
+ */
+
+/************************************************************************/
+
+typedef CLI::Helpers::OwnedGames OwnedGames;
+typedef CLI::Helpers::BadgeData BadgeData;
+typedef CLI::Helpers::Licenses Licenses;
+
+/************************************************************************/
+
+namespace
+{
+    class MemoryCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        virtual bool global() const
+        {
+            return true;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("memory");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("show approximate memory usage of accounts");
+            return string;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("top",
+                     boost::program_options::value<unsigned int>()->value_name("count")->default_value(10),
+                     "number of largest items to list")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+    public:
+        class Execute : public ExecuteBase
+        {
+        private:
+            unsigned int top=10;
+
+        public:
+            using ExecuteBase::ExecuteBase;
+
+            virtual ~Execute() =default;
+
+        public:
+            virtual bool init(const boost::program_options::variables_map& options) override
+            {
+                top=options["top"].as<unsigned int>();
+                return true;
+            }
+
+            virtual void execute(SteamBot::ClientInfo*) const override;
+        };
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
+        {
+            return std::make_shared<Execute>(cli);
+        }
+    };
+
+    MemoryCommand::Init<MemoryCommand> init;
+}
+
+/************************************************************************/
+
+namespace
+{
+    enum class Item : unsigned int { OwnedGames, Licenses, BadgeData, Max };
+
+    const char* getItemName(Item item)
+    {
+        switch(item)
+        {
+        case Item::OwnedGames: return "OwnedGames";
+        case Item::Licenses: return "Licenses";
+        case Item::BadgeData: return "BadgeData";
+        default: assert(false); return nullptr;
+        }
+    }
+
+    typedef std::array<size_t, static_cast<size_t>(Item::Max)> Sizes;
+}
+
+/************************************************************************/
+/*
+ * A node in a std::map or std::unordered_map has a few pointers in
+ * addition to the value.
+ */
+
+template <typename T> static size_t getMapSize(const T& map)
+{
+    return map.size()*(sizeof(typename T::value_type)+3*sizeof(void*));
+}
+
+/************************************************************************/
+/*
+ * Runs on the client thread.
+ *
+ * We only look at what is already on the whiteboard; anything that
+ * would have to be fetched from Steam, like the trade offers, is
+ * left out.
+ *
+ * OwnedGames doesn't give us a list of games, so we look up the apps
+ * from our licenses instead.
+ */
+
+static Sizes getSizes(SteamBot::Client& client)
+{
+    Sizes sizes{};
+
+    Licenses::Ptr licenses;
+    if (auto lic=client.whiteboard.has<Licenses::Ptr>())
+    {
+        licenses=*lic;
+        sizes[static_cast<size_t>(Item::Licenses)]=sizeof(Licenses)+getMapSize(licenses->licenses)+licenses->licenses.size()*sizeof(Licenses::LicenseInfo);
+    }
+
+    if (auto games=client.whiteboard.has<OwnedGames::Ptr>())
+    {
+        size_t& size=sizes[static_cast<size_t>(Item::OwnedGames)];
+        size=sizeof(OwnedGames);
+        if (licenses)
+        {
+            std::unordered_set<SteamBot::AppID> seen;
+            CLI::Helpers::forEachLicensedApp(*licenses, [&](const CLI::Helpers::LicenseInfo&, SteamBot::AppID appId) {
+                if (seen.insert(appId).second)
+                {
+                    if (auto info=(*games)->getInfo(appId))
+                    {
+                        size+=sizeof(*info)+3*sizeof(void*)+info->name.capacity();
+                    }
+                }
+            });
+        }
+    }
+
+    if (auto badges=client.whiteboard.has<BadgeData::Ptr>())
+    {
+        sizes[static_cast<size_t>(Item::BadgeData)]=sizeof(BadgeData)+getMapSize((*badges)->badges);
+    }
+
+    return sizes;
+}
+
+/************************************************************************/
+
+void MemoryCommand::Execute::execute(SteamBot::ClientInfo*) const
+{
+    struct Entry
+    {
+        const SteamBot::ClientInfo* clientInfo;
+        Item item;
+        size_t size;
+    };
+
+    std::vector<Entry> entries;
+    size_t fleetTotal=0;
+
+    enum class Columns : unsigned int { Account, OwnedGames, Licenses, BadgeData, Total, Max };
+    SteamBot::UI::Table<Columns> table;
+
+    for (const SteamBot::ClientInfo* clientInfo : SteamBot::ClientInfo::getClients())
+    {
+        if (auto client=clientInfo->getClient())
+        {
+            const auto sizes=cli.helpers->execute(std::move(client), [](SteamBot::Client& client_) {
+                return getSizes(client_);
+            });
+            if (!sizes)
+            {
+                continue;
+            }
+
+            decltype(table)::Line line;
+            line[Columns::Account] << clientInfo->accountName;
+
+            size_t total=0;
+            for (size_t i=0; i<sizes->size(); i++)
+            {
+                line[static_cast<Columns>(static_cast<unsigned int>(Columns::OwnedGames)+i)] << SteamBot::printSize((*sizes)[i]);
+                entries.push_back(Entry{clientInfo, static_cast<Item>(i), (*sizes)[i]});
+                total+=(*sizes)[i];
+            }
+            line[Columns::Total] << SteamBot::printSize(total);
+            fleetTotal+=total;
+
+            table.add(line);
+        }
+    }
+
+    if (entries.empty())
+    {
+        std::cout << "no running accounts found" << std::endl;
+        return;
+    }
+
+    table.sort(Columns::Account);
+    std::cout << "account: OwnedGames | Licenses | BadgeData | total\n";
+    while (table.startLine())
+    {
+        std::cout << table.getContent(Columns::Account) << table.getFiller(Columns::Account);
+        for (auto column : { Columns::OwnedGames, Columns::Licenses, Columns::BadgeData })
+        {
+            std::cout << " | " << table.getFiller(column) << table.getContent(column);
+        }
+        std::cout << " | " << table.getContent(Columns::Total) << '\n';
+    }
+
+    std::cout << "fleet total: " << SteamBot::printSize(fleetTotal) << '\n';
+
+    {
+        const auto count=std::min(entries.size(), static_cast<size_t>(top));
+        std::partial_sort(entries.begin(), entries.begin()+static_cast<ptrdiff_t>(count), entries.end(), [](const Entry& left, const Entry& right) {
+            return left.size>right.size;
+        });
+
+        std::cout << "largest items:\n";
+        for (size_t i=0; i<count; i++)
+        {
+            std::cout << "   " << SteamBot::printSize(entries[i].size) << ": " << entries[i].clientInfo->accountName << " " << getItemName(entries[i].item) << '\n';
+        }
+    }
+
+    std::cout << std::flush;
+}
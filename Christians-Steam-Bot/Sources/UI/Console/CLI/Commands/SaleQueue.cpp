@@ -24,11 +24,18 @@
 #include "Modules/Executor.hpp"
 
 /************************************************************************/
+/*
+ * Note: SaleQueue::clear() doesn't tell us how many items it went
+ * through, so we only report the time it took.
+ */
 
 void SteamBot::UI::CLI::performSaleQueue()
 {
     SteamBot::UI::OutputText() << "ClI: requested sale queue clearing";
+    const auto start=std::chrono::steady_clock::now();
     SteamBot::SaleQueue::clear();
+    const auto seconds=std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now()-start);
+    SteamBot::UI::OutputText() << "ClI: sale queue clearing finished after " << seconds.count() << " seconds";
 }
 
 /************************************************************************/
@@ -55,6 +62,11 @@ namespace
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
     public:
         class Execute : public ExecuteBase
         {
@@ -56,6 +56,11 @@ namespace
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
     public:
         class Execute : public ExecuteBase
         {
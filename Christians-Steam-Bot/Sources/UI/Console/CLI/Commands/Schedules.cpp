@@ -0,0 +1,345 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+
+#include "../Schedules.hpp"
+
+#include "Helpers/Time.hpp"
+
+#include <algorithm>
+
+/************************************************************************/
+
+namespace Schedules=SteamBot::UI::Schedules;
+
+/************************************************************************/
+/*
+ * A single word is the quoted command line, as in
+ *    schedules add games 12:00 "list-games --limit 5"
+ * and we store it as it is.
+ *
+ * Otherwise, we need to quote the words again, so split_unix()
+ * gives us the same words when we run the job.
+ */
+
+static std::string makeCommand(const std::vector<std::string>& words)
+{
+    if (words.size()==1)
+    {
+        return words.front();
+    }
+
+    std::string command;
+    for (const auto& word : words)
+    {
+        if (!command.empty())
+        {
+            command.push_back(' ');
+        }
+        if (!word.empty() && word.find_first_of(" \t\"'\\")==std::string::npos)
+        {
+            command.append(word);
+        }
+        else
+        {
+            command.push_back('"');
+            for (const char c : word)
+            {
+                if (c=='"' || c=='\'' || c=='\\')
+                {
+                    command.push_back('\\');
+                }
+                command.push_back(c);
+            }
+            command.push_back('"');
+        }
+    }
+    return command;
+}
+
+/************************************************************************/
+
+namespace
+{
+    class SchedulesCommand : public SteamBot::UI::CommandBase
+    {
+    public:
+        virtual bool global() const
+        {
+            return false;
+        }
+
+        virtual const std::string_view& command() const override
+        {
+            static const std::string_view string("schedules");
+            return string;
+        }
+
+        virtual const std::string_view& description() const override
+        {
+            static const std::string_view string("list, add, pause or run scheduled commands");
+            return string;
+        }
+
+        virtual const boost::program_options::positional_options_description* positionals() const override
+        {
+            static auto const positional=[](){
+                auto positional_=new boost::program_options::positional_options_description();
+                positional_->add("action", 1);
+                positional_->add("name", 1);
+                positional_->add("time", 1);
+                positional_->add("command", -1);
+                return positional_;
+            }();
+            return positional;
+        }
+
+        virtual const boost::program_options::options_description* options() const override
+        {
+            static auto const options=[](){
+                auto options_=new boost::program_options::options_description();
+                options_->add_options()
+                    ("action",
+                     boost::program_options::value<std::string>()->value_name("list|add|remove|pause|resume|run"),
+                     "what to do (default: list)")
+                    ("name",
+                     boost::program_options::value<std::string>(),
+                     "name of the job")
+                    ("time",
+                     boost::program_options::value<std::string>()->value_name("HH:MM"),
+                     "when to run the job every day (UTC)")
+                    ("command",
+                     boost::program_options::value<std::vector<std::string>>()->multitoken(),
+                     "the command to run")
+                    ("jitter",
+                     boost::program_options::value<unsigned int>()->value_name("minutes")->default_value(0),
+                     "delay the job by up to this many minutes, different for each account")
+                    ;
+                return options_;
+            }();
+            return options;
+        }
+
+    public:
+        class Execute : public ExecuteBase
+        {
+        private:
+            enum class Action { List, Add, Remove, Pause, Resume, Run };
+
+            Action action=Action::List;
+            Schedules::Job job;
+
+        public:
+            using ExecuteBase::ExecuteBase;
+
+            virtual ~Execute() =default;
+
+        public:
+            virtual bool init(const boost::program_options::variables_map& options) override
+            {
+                if (options.count("action"))
+                {
+                    static const std::unordered_map<std::string_view, Action> actions={
+                        { "list", Action::List },
+                        { "add", Action::Add },
+                        { "remove", Action::Remove },
+                        { "pause", Action::Pause },
+                        { "resume", Action::Resume },
+                        { "run", Action::Run }
+                    };
+                    auto iterator=actions.find(options["action"].as<std::string>());
+                    if (iterator==actions.end())
+                    {
+                        return false;
+                    }
+                    action=iterator->second;
+                }
+
+                if (action!=Action::List)
+                {
+                    if (!options.count("name"))
+                    {
+                        return false;
+                    }
+                    job.name=options["name"].as<std::string>();
+                }
+
+                if (action==Action::Add)
+                {
+                    if (!options.count("time") || !options.count("command"))
+                    {
+                        return false;
+                    }
+                    if (!Schedules::parseTime(options["time"].as<std::string>(), job.minute))
+                    {
+                        std::cout << "invalid time \"" << options["time"].as<std::string>() << "\"" << std::endl;
+                        return false;
+                    }
+                    job.command=makeCommand(options["command"].as<std::vector<std::string>>());
+                    {
+                        // "watch" and "time" are for interactive use, and a job
+                        // that runs "schedules" could end up running itself.
+                        // The account is added when the job runs.
+                        const auto words=boost::program_options::split_unix(job.command);
+                        if (words.empty())
+                        {
+                            return false;
+                        }
+                        if (words.front()=="watch" || words.front()=="time" || words.front()=="schedules")
+                        {
+                            std::cout << "\"" << words.front() << "\" cannot be used in scheduled jobs" << std::endl;
+                            return false;
+                        }
+                        if (words.front().back()==':')
+                        {
+                            std::cout << "scheduled jobs always run on their own account; remove \"" << words.front() << "\"" << std::endl;
+                            return false;
+                        }
+                    }
+                    job.jitter=options["jitter"].as<unsigned int>();
+                }
+                else if (options.count("time") || options.count("command"))
+                {
+                    return false;
+                }
+
+                return true;
+            }
+
+        private:
+            void list(const SteamBot::ClientInfo&) const;
+            void change(const SteamBot::ClientInfo&) const;
+
+        public:
+            virtual void execute(SteamBot::ClientInfo*) const override;
+        };
+
+        virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
+        {
+            return std::make_shared<Execute>(cli);
+        }
+    };
+
+    SchedulesCommand::Init<SchedulesCommand> init;
+}
+
+/************************************************************************/
+
+void SchedulesCommand::Execute::list(const SteamBot::ClientInfo& clientInfo) const
+{
+    const auto jobs=Schedules::load(clientInfo);
+    if (jobs.empty())
+    {
+        std::cout << clientInfo.accountName << ": no scheduled jobs" << std::endl;
+        return;
+    }
+
+    std::cout << clientInfo.accountName << ":\n";
+    for (const auto& job : jobs)
+    {
+        std::cout << "   " << job.name << ": " << Schedules::timeString(job.getMinute(clientInfo.accountName)) << " UTC";
+        if (job.jitter!=0)
+        {
+            std::cout << " (" << Schedules::timeString(job.minute) << " + up to " << job.jitter << " minutes)";
+        }
+        if (job.paused)
+        {
+            std::cout << ", paused";
+        }
+        std::cout << ": " << job.command << '\n';
+        if (job.lastRun!=std::chrono::system_clock::time_point())
+        {
+            std::cout << "      last run " << SteamBot::Time::toString(job.lastRun) << '\n';
+        }
+    }
+    std::cout << std::flush;
+}
+
+/************************************************************************/
+
+void SchedulesCommand::Execute::change(const SteamBot::ClientInfo& clientInfo) const
+{
+    auto jobs=Schedules::load(clientInfo);
+    auto iterator=std::find_if(jobs.begin(), jobs.end(), [this](const Schedules::Job& item) { return item.name==job.name; });
+
+    if (action==Action::Add)
+    {
+        if (iterator==jobs.end())
+        {
+            jobs.push_back(job);
+        }
+        else
+        {
+            *iterator=job;
+        }
+    }
+    else if (iterator==jobs.end())
+    {
+        std::cout << clientInfo.accountName << ": no scheduled job \"" << job.name << "\"" << std::endl;
+        return;
+    }
+    else
+    {
+        switch(action)
+        {
+        case Action::Remove:
+            jobs.erase(iterator);
+            break;
+
+        case Action::Pause:
+            iterator->paused=true;
+            break;
+
+        case Action::Resume:
+            iterator->paused=false;
+            break;
+
+        default:
+            assert(false);
+        }
+    }
+
+    Schedules::save(clientInfo, jobs);
+    list(clientInfo);
+}
+
+/************************************************************************/
+
+void SchedulesCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
+{
+    switch(action)
+    {
+    case Action::List:
+        list(*clientInfo);
+        break;
+
+    case Action::Run:
+        if (!Schedules::run(cli, *clientInfo, job.name))
+        {
+            std::cout << clientInfo->accountName << ": no scheduled job \"" << job.name << "\"" << std::endl;
+        }
+        break;
+
+    default:
+        change(*clientInfo);
+        break;
+    }
+}
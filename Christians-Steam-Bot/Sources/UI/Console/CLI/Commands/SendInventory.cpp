@@ -44,15 +44,20 @@ namespace
 
         virtual const std::string_view& description() const override
         {
-            static const std::string_view string("send all tradable Steam items to another bot account");
+            static const std::string_view string("send all tradable Steam items to other bot accounts");
             return string;
         }
 
+        virtual bool background() const override
+        {
+            return true;
+        }
+
         virtual const boost::program_options::positional_options_description* positionals() const override
         {
             static auto const positional=[](){
                 auto positional_=new boost::program_options::positional_options_description();
-                positional_->add("recipient", 1);
+                positional_->add("recipient", -1);
                 return positional_;
             }();
             return positional;
@@ -64,8 +69,8 @@ namespace
                 auto options_=new boost::program_options::options_description();
                 options_->add_options()
                     ("recipient",
-                     boost::program_options::value<SteamBot::OptionBotName>()->value_name("accountname"),
-                     "recipient account")
+                     boost::program_options::value<std::vector<SteamBot::OptionBotName>>()->value_name("accountname")->multitoken(),
+                     "recipient accounts")
                     ;
                 return options_;
             }();
@@ -76,37 +81,38 @@ namespace
         class Execute : public ExecuteBase
         {
         private:
-            SteamBot::ClientInfo* clientInfo=nullptr;
+            // nullptr means the default recipient
+            std::vector<SteamBot::ClientInfo*> recipients;
+
+            // senders take turns on the recipients
+            mutable size_t nextRecipient=0;
 
         public:
             using ExecuteBase::ExecuteBase;
 
             virtual ~Execute() =default;
 
+        private:
+            SteamBot::ClientInfo* getRecipient(const SteamBot::ClientInfo*) const;
+
         public:
             virtual bool init(const boost::program_options::variables_map& options) override
             {
                 if (options.count("recipient"))
                 {
-                    clientInfo=options["recipient"].as<SteamBot::OptionBotName>().clientInfo;
+                    for (const auto& recipient : options["recipient"].as<std::vector<SteamBot::OptionBotName>>())
+                    {
+                        recipients.push_back(recipient.clientInfo);
+                    }
                 }
-                return true;
-            }
-
-            virtual void execute(SteamBot::ClientInfo* clientInfo_) const override
-            {
-                bool success=false;
-                if (auto client=clientInfo_->getClient())
+                if (recipients.empty())
                 {
-                    SteamBot::Modules::Executor::execute(std::move(client), [this, &success](SteamBot::Client&) {
-                        success=SteamBot::sendInventory(this->clientInfo);
-                    });
-                }
-                if (!success)
-                {
-                    std::cout << "failed to send inventory" << std::endl;
+                    recipients.push_back(nullptr);
                 }
+                return true;
             }
+
+            virtual void execute(SteamBot::ClientInfo*) const override;
         };
 
         virtual std::shared_ptr<ExecuteBase> makeExecute(SteamBot::UI::CLI& cli) const override
@@ -117,3 +123,61 @@ namespace
 
     SendInventoryCommand::Init<SendInventoryCommand> init;
 }
+
+/************************************************************************/
+/*
+ * Picks the next recipient, skipping the sender itself. Returns the
+ * sender if there is nobody else.
+ */
+
+SteamBot::ClientInfo* SendInventoryCommand::Execute::getRecipient(const SteamBot::ClientInfo* sender) const
+{
+    for (size_t i=0; i<recipients.size(); i++)
+    {
+        auto recipient=recipients[nextRecipient++%recipients.size()];
+        if (recipient!=sender)
+        {
+            return recipient;
+        }
+    }
+    return const_cast<SteamBot::ClientInfo*>(sender);
+}
+
+/************************************************************************/
+/*
+ * The transfer runs on its own fiber, so sending from a group of
+ * accounts doesn't wait for each account to finish before starting
+ * the next one. The result is reported when it's done.
+ */
+
+void SendInventoryCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
+{
+    auto recipient=getRecipient(clientInfo);
+    if (recipient==clientInfo)
+    {
+        std::cout << "account \"" << clientInfo->accountName << "\" can't send its inventory to itself" << std::endl;
+        return;
+    }
+
+    const std::string description=clientInfo->accountName+" to "+(recipient!=nullptr ? recipient->accountName : std::string("the default recipient"));
+
+    bool success=false;
+    if (auto client=clientInfo->getClient())
+    {
+        success=SteamBot::Modules::Executor::executeWithFiber(std::move(client), [recipient, description](SteamBot::Client&) {
+            const auto start=std::chrono::steady_clock::now();
+            const bool sent=SteamBot::sendInventory(recipient);
+            const auto seconds=std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now()-start);
+            SteamBot::UI::OutputText() << "ClI: sending inventory from " << description << (sent ? " finished" : " failed") << " after " << seconds.count() << " seconds";
+        });
+    }
+
+    if (success)
+    {
+        std::cout << "requested sending inventory from " << description << std::endl;
+    }
+    else
+    {
+        std::cout << "failed to send inventory from " << description << std::endl;
+    }
+}
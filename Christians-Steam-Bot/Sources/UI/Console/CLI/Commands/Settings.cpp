@@ -21,6 +21,8 @@
 #include "UI/Command.hpp"
 #include "UI/Table.hpp"
 
+#include "../Helpers.hpp"
+
 #include "Settings.hpp"
 #include "Modules/Executor.hpp"
 
@@ -127,15 +129,18 @@ void SettingsCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
     {
         if (name.empty() && value.empty())
         {
-            std::map<std::string_view, std::string> items;
-            SteamBot::Modules::Executor::execute(std::move(client), [&items](SteamBot::Client&) mutable {
-                items=SteamBot::Settings::getValues();
+            auto items=cli.helpers->execute(std::move(client), [](SteamBot::Client&) {
+                return SteamBot::Settings::getValues();
             });
+            if (!items)
+            {
+                return;
+            }
 
             enum class Columns : unsigned int { Name, Value, Max };
             SteamBot::UI::Table<Columns> table;
 
-            for (const auto& item: items)
+            for (const auto& item: *items)
             {
                 decltype(table)::Line line;
                 line[Columns::Name] << item.first;
@@ -161,19 +166,20 @@ void SettingsCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
         }
         else
         {
-            bool success=false;
-
-            SteamBot::Modules::Executor::execute(std::move(client), [&success, this](SteamBot::Client&) {
-                success=SteamBot::Settings::changeValue(name, value);
+            auto success=cli.helpers->execute(std::move(client), [name=name, value=value](SteamBot::Client&) {
+                return SteamBot::Settings::changeValue(name, value);
             });
 
             if (success)
             {
-                std::cout << "changed setting" << std::endl;
-            }
-            else
-            {
-                std::cout << "failed to change setting (bad name or invalid value)" << std::endl;
+                if (*success)
+                {
+                    std::cout << "changed setting" << std::endl;
+                }
+                else
+                {
+                    std::cout << "failed to change setting (bad name or invalid value)" << std::endl;
+                }
             }
         }
     }
@@ -20,6 +20,8 @@
 #include "UI/CLI.hpp"
 #include "UI/Command.hpp"
 
+#include "../Helpers.hpp"
+
 #include "Modules/PackageData.hpp"
 #include "Modules/Executor.hpp"
 #include "Client/ClientInfo.hpp"
@@ -261,6 +263,11 @@ void Info::print()
 }
 
 /************************************************************************/
+/*
+ * Runs on the client thread, inside the CLI::Helpers::execute() call,
+ * so we don't need a separate trip for the licenses. DLCs that we
+ * don't own have no license, so addLicenses() just skips them.
+ */
 
 void Info::init()
 {
@@ -277,11 +284,15 @@ void ShowLicenseCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) cons
 {
     if (auto client=clientInfo->getClient())
     {
-        Info info(appId);
-        SteamBot::Modules::Executor::execute(std::move(client), [&info](SteamBot::Client&) {
-            info.init();
+        auto info=cli.helpers->execute(std::move(client), [game=appId](SteamBot::Client&) {
+            Info info_(game);
+            info_.init();
+            return info_;
         });
 
-        info.print();
+        if (info)
+        {
+            info->print();
+        }
     }
 }
@@ -19,6 +19,9 @@
 
 #include "UI/CLI.hpp"
 #include "UI/Command.hpp"
+#include "UI/Counters.hpp"
+
+#include "../Helpers.hpp"
 
 #include "EnumString.hpp"
 #include "Modules/LicenseList.hpp"
@@ -84,89 +87,34 @@ class Processor
 private:
     Licenses::Ptr licenses;
 
-    void getWhiteboardData(std::shared_ptr<SteamBot::Client>);
+    void getWhiteboardData(CLI&, std::shared_ptr<SteamBot::Client>);
     void process() const;
 
 public:
-    Processor(std::shared_ptr<SteamBot::Client>);
+    Processor(CLI&, std::shared_ptr<SteamBot::Client>);
 };
 
 /************************************************************************/
 
-template <typename T, typename U=uint32_t> class Counters
-{
-    typedef  std::pair<T, U> Entry;
-    std::vector<Entry> counters;
-
-public:
-    U& set(T key)
-    {
-        for (auto& entry: counters)
-        {
-            if (entry.first==key)
-            {
-                return entry.second;
-            }
-        }
-        auto &result=counters.emplace_back();
-        result.first=key;
-        return result.second;
-    }
-
-    U& add(T key)
-    {
-        return ++set(key);
-    }
+using SteamBot::UI::Counters;
 
-    U get(T key) const
-    {
-        for (auto& entry: counters)
-        {
-            if (entry.first==key)
-            {
-                return entry.second;
-            }
-        }
-        return U{};
-    }
-
-    bool empty() const
-    {
-        return counters.empty();
-    }
-
-    void sort()
-    {
-        std::sort(counters.begin(), counters.end(),
-                  [](const Entry& left, const Entry &right)
-                  {
-                      return left.second>right.second;
-                  });
-    }
+/************************************************************************/
 
-    void print()
-    {
-        sort();
-        for (const auto& entry: counters)
+void Processor::getWhiteboardData(CLI& cli, std::shared_ptr<SteamBot::Client> client)
+{
+    auto result=cli.helpers->execute(std::move(client), [](SteamBot::Client& client_) {
+        Licenses::Ptr result_;
+        if (auto lic=client_.whiteboard.has<Licenses::Ptr>())
         {
-            std::cout << "   " << entry.second << " \xC3\x97 " << SteamBot::enumToString(entry.first) << "\n";
+            result_=*lic;
         }
-    }
-
-    const auto& getCounters() const
+        return result_;
+    });
+    if (!result)
     {
-        return counters;
+        return;
     }
-};
-
-/************************************************************************/
-
-void Processor::getWhiteboardData(std::shared_ptr<SteamBot::Client> client)
-{
-    typedef SteamBot::Modules::Executor::GetWhiteboard<Licenses::Ptr> GetWhiteboard;
-    GetWhiteboard::ResultType result;
-    GetWhiteboard::perform(std::move(client), result);
-    licenses=std::move(std::get<Licenses::Ptr>(result));
+    licenses=std::move(*result);
 
     if (!licenses)
     {
@@ -353,9 +301,9 @@ void Processor::process() const
 
 /************************************************************************/
 
-Processor::Processor(std::shared_ptr<SteamBot::Client> client)
+Processor::Processor(CLI& cli, std::shared_ptr<SteamBot::Client> client)
 {
-    getWhiteboardData(std::move(client));
+    getWhiteboardData(cli, std::move(client));
     if (licenses)
     {
         std::cout << licenses->licenses.size() << " licenses\n";
@@ -369,6 +317,6 @@ void StatsCommand::Execute::execute(SteamBot::ClientInfo* clientInfo) const
 {
     if (auto client=clientInfo->getClient())
     {
-        Processor processor(std::move(client));
+        Processor processor(cli, std::move(client));
     }
 }
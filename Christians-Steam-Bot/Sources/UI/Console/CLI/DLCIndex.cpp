@@ -0,0 +1,115 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "./DLCIndex.hpp"
+#include "./Helpers.hpp"
+
+#include "AppInfo.hpp"
+#include "Steam/AppType.hpp"
+
+/************************************************************************/
+
+typedef SteamBot::UI::DLCIndex DLCIndex;
+
+/************************************************************************/
+/*
+ * We only ask AppInfo for the DLCs of games that we actually own,
+ * and only once per license snapshot; the lookups just use the maps.
+ */
+
+DLCIndex::DLCIndex(Licenses::Ptr licenses_)
+    : licenses(std::move(licenses_))
+{
+    if (licenses)
+    {
+        CLI::Helpers::forEachLicensedApp(*licenses, [this](const Licenses::LicenseInfo&, SteamBot::AppID appId) {
+            ownedApps.insert(appId);
+        });
+    }
+
+    for (const auto appId : ownedApps)
+    {
+        if (SteamBot::AppInfo::getAppType(appId)!=SteamBot::AppType::DLC)
+        {
+            for (const auto dlc : SteamBot::AppInfo::getDLCs(appId))
+            {
+                if (ownedApps.contains(dlc))
+                {
+                    ownedDLCs[appId].push_back(dlc);
+                    baseGames.try_emplace(dlc, appId);
+                }
+                else
+                {
+                    missingDLCs[appId].push_back(dlc);
+                }
+            }
+        }
+    }
+}
+
+/************************************************************************/
+
+DLCIndex::~DLCIndex() =default;
+
+/************************************************************************/
+
+bool DLCIndex::isOwned(SteamBot::AppID appId) const
+{
+    return ownedApps.contains(appId);
+}
+
+/************************************************************************/
+
+static const std::vector<SteamBot::AppID>& getList(const std::unordered_map<SteamBot::AppID, std::vector<SteamBot::AppID>>& map, SteamBot::AppID appId)
+{
+    static const std::vector<SteamBot::AppID> empty;
+
+    auto iterator=map.find(appId);
+    if (iterator!=map.end())
+    {
+        return iterator->second;
+    }
+    return empty;
+}
+
+/************************************************************************/
+
+const std::vector<SteamBot::AppID>& DLCIndex::getOwnedDLCs(SteamBot::AppID appId) const
+{
+    return getList(ownedDLCs, appId);
+}
+
+/************************************************************************/
+
+const std::vector<SteamBot::AppID>& DLCIndex::getMissingDLCs(SteamBot::AppID appId) const
+{
+    return getList(missingDLCs, appId);
+}
+
+/************************************************************************/
+
+SteamBot::AppID DLCIndex::getBaseGame(SteamBot::AppID appId) const
+{
+    auto iterator=baseGames.find(appId);
+    if (iterator!=baseGames.end())
+    {
+        return iterator->second;
+    }
+    return SteamBot::AppID::None;
+}
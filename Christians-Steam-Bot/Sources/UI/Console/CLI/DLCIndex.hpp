@@ -0,0 +1,75 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Modules/LicenseList.hpp"
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+/************************************************************************/
+/*
+ * Maps base games to the DLCs we own for them, and the other way
+ * around.
+ *
+ * This is built from a snapshot of the license list, so it has to be
+ * rebuilt when the licenses change; CLI::Helpers::getDLCIndex() takes
+ * care of that.
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        class DLCIndex
+        {
+        public:
+            typedef SteamBot::Modules::LicenseList::Whiteboard::Licenses Licenses;
+            typedef std::shared_ptr<const DLCIndex> Ptr;
+
+        public:
+            const Licenses::Ptr licenses;
+
+        private:
+            std::unordered_set<SteamBot::AppID> ownedApps;
+            std::unordered_map<SteamBot::AppID, std::vector<SteamBot::AppID>> ownedDLCs;
+            std::unordered_map<SteamBot::AppID, std::vector<SteamBot::AppID>> missingDLCs;
+            std::unordered_map<SteamBot::AppID, SteamBot::AppID> baseGames;
+
+        public:
+            DLCIndex(Licenses::Ptr);
+            ~DLCIndex();
+
+        public:
+            bool isOwned(SteamBot::AppID) const;
+
+            // the DLCs we own for the game
+            const std::vector<SteamBot::AppID>& getOwnedDLCs(SteamBot::AppID) const;
+
+            // the DLCs we don't own for the game
+            const std::vector<SteamBot::AppID>& getMissingDLCs(SteamBot::AppID) const;
+
+            // the base game of an owned DLC, or AppID::None
+            SteamBot::AppID getBaseGame(SteamBot::AppID) const;
+        };
+    }
+}
@@ -19,10 +19,10 @@
 
 #include "./Helpers.hpp"
 
-#include "Modules/Executor.hpp"
-#include "Modules/PackageData.hpp"
+#include "AppInfo.hpp"
 
 #include <charconv>
+#include <algorithm>
 
 /************************************************************************/
 
@@ -38,24 +38,107 @@ Helpers::Helpers(CLI& cli_)
 Helpers::~Helpers() =default;
 
 /************************************************************************/
+/*
+ * We also drop the indexes of accounts that are no longer running,
+ * so we don't keep their old license lists alive.
+ */
 
-std::vector<std::shared_ptr<const Helpers::LicenseInfo>> Helpers::getLicenseInfo(const SteamBot::ClientInfo& clientInfo, SteamBot::AppID appId)
+SteamBot::UI::DLCIndex::Ptr Helpers::getDLCIndex(const SteamBot::ClientInfo& clientInfo, const Licenses::Ptr& licenses)
 {
-    std::vector<std::shared_ptr<const LicenseInfo>> result;
-    if (auto client=clientInfo.getClient())
+    std::erase_if(dlcIndexes, [&clientInfo](const auto& item) {
+        return item.first!=&clientInfo && !item.first->getClient();
+    });
+
+    auto& index=dlcIndexes[&clientInfo];
+    if (!index || index->licenses!=licenses)
+    {
+        index=std::make_shared<SteamBot::UI::DLCIndex>(licenses);
+    }
+    return index;
+}
+
+/************************************************************************/
+
+std::string Helpers::getAppName(SteamBot::AppID appId)
+{
+    if (auto json=SteamBot::AppInfo::get(appId, "common", "name"))
+    {
+        if (auto string=json->if_string())
+        {
+            return std::string(*string);
+        }
+    }
+    return std::string();
+}
+
+/************************************************************************/
+
+std::vector<SteamBot::ClientInfo*> Helpers::expandAccountNames(const std::vector<std::string>& names)
+{
+    if (names.empty())
     {
-        SteamBot::Modules::Executor::execute(std::move(client), [appId, &result](SteamBot::Client&) mutable {
-            auto packages=SteamBot::Modules::PackageData::getPackageInfo(appId);
-            for (const auto& package : packages)
+        return CLI::expandAccountName("*");
+    }
+
+    std::vector<SteamBot::ClientInfo*> clients;
+    for (const auto& name : names)
+    {
+        auto expanded=CLI::expandAccountName(name);
+        if (expanded.empty())
+        {
+            return {};
+        }
+        for (auto info : expanded)
+        {
+            if (std::find(clients.begin(), clients.end(), info)==clients.end())
             {
-                if (auto licenseInfo=SteamBot::Modules::LicenseList::getLicenseInfo(package->packageId))
-                {
-                    result.emplace_back(std::move(licenseInfo));
-                }
+                clients.push_back(info);
             }
-        });
+        }
+    }
+    return clients;
+}
+
+/************************************************************************/
+/*
+ * Waits for the flag to become true, with Helpers::executeTimeout.
+ * The client thread calls CLI::wakeup() when it sets the flag, so
+ * we don't have to poll.
+ *
+ * Returns false if the time has run out, or the user has pressed
+ * RETURN. Scheduled jobs run without the keyboard, so they only have
+ * the time limit.
+ */
+
+bool Helpers::waitFor(const std::atomic<bool>& done, std::string_view accountName)
+{
+    static constexpr std::chrono::seconds hintDelay{2};
+
+    const auto start=std::chrono::steady_clock::now();
+    bool hint=false;
+
+    while (!done)
+    {
+        const auto elapsed=std::chrono::steady_clock::now()-start;
+        if (elapsed>=executeTimeout)
+        {
+            std::cout << "account \"" << accountName << "\" did not respond within " << executeTimeout.count() << " seconds; giving up" << std::endl;
+            return false;
+        }
+        if (!hint && cli.interactive && elapsed>=hintDelay)
+        {
+            std::cout << "waiting for account \"" << accountName << "\"; press RETURN to cancel" << std::endl;
+            hint=true;
+        }
+
+        const auto remaining=((hint || !cli.interactive) ? executeTimeout : std::chrono::duration_cast<std::chrono::steady_clock::duration>(hintDelay))-elapsed;
+        if (cli.waitForReturn(std::chrono::ceil<std::chrono::milliseconds>(remaining)))
+        {
+            std::cout << "cancelled" << std::endl;
+            return false;
+        }
     }
-    return result;
+    return true;
 }
 
 /************************************************************************/
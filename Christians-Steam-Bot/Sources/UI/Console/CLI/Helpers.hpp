@@ -19,10 +19,23 @@
 
 #pragma once
 
+#include "Client/Client.hpp"
 #include "Client/ClientInfo.hpp"
 #include "Modules/BadgeData.hpp"
+#include "Modules/Executor.hpp"
+#include "Modules/PackageData.hpp"
+#include "Modules/PackageInfo.hpp"
+#include "Helpers/Destruct.hpp"
 
 #include "../Console.hpp"
+#include "./DLCIndex.hpp"
+
+#include <optional>
+#include <atomic>
+#include <exception>
+#include <unordered_map>
+#include <vector>
+#include <string>
 
 /************************************************************************/
 
@@ -44,7 +57,112 @@ public:
     typedef SteamBot::Modules::BadgeData::Whiteboard::BadgeData BadgeData;
     typedef SteamBot::Modules::LicenseList::Whiteboard::Licenses Licenses;
     typedef Licenses::LicenseInfo LicenseInfo;
-    static std::vector<std::shared_ptr<const LicenseInfo>> getLicenseInfo(const SteamBot::ClientInfo&, SteamBot::AppID);
+
+private:
+    std::unordered_map<const SteamBot::ClientInfo*, SteamBot::UI::DLCIndex::Ptr> dlcIndexes;
+
+public:
+    // returns the DLC index for the licenses, building a new one if the licenses have changed
+    SteamBot::UI::DLCIndex::Ptr getDLCIndex(const SteamBot::ClientInfo&, const Licenses::Ptr&);
+
+public:
+    // the name from AppInfo, or an empty string
+    static std::string getAppName(SteamBot::AppID);
+
+    // expands the names like CLI::expandAccountName(), without duplicates; no names means "*".
+    // Returns an empty list if one of the names didn't match anything.
+    static std::vector<SteamBot::ClientInfo*> expandAccountNames(const std::vector<std::string>&);
+
+    // calls function(license, appId) for every app of every license; apps can show up more than once
+    template <typename FUNC> static void forEachLicensedApp(const Licenses& licenses, FUNC&& function)
+    {
+        for (const auto& license : licenses.licenses)
+        {
+            if (auto package=SteamBot::Modules::PackageData::getPackageInfo(*(license.second)))
+            {
+                for (const auto appId : package->appIds)
+                {
+                    function(*(license.second), appId);
+                }
+            }
+        }
+    }
+
+private:
+    bool waitFor(const std::atomic<bool>&, std::string_view);
+
+public:
+    /*
+     * Runs the function on the client thread, and returns its result.
+     *
+     * Unlike a plain Executor::execute(), this gives up after a
+     * timeout, or when the user presses RETURN; in that case, we
+     * return an empty optional.
+     *
+     * The result lives in shared storage, so the client thread can
+     * still finish the function after we have given up. If the
+     * function hasn't started yet, it will be skipped.
+     *
+     * If the function throws, the exception is rethrown here.
+     */
+    static constexpr std::chrono::seconds executeTimeout{60};
+
+    template <typename FUNC> auto execute(std::shared_ptr<SteamBot::Client> client, FUNC&& function)
+        -> std::optional<std::invoke_result_t<FUNC, SteamBot::Client&>>
+    {
+        struct State
+        {
+            std::optional<std::invoke_result_t<FUNC, SteamBot::Client&>> result;
+            std::exception_ptr exception;
+            std::atomic<bool> done=false;
+            std::atomic<bool> abandoned=false;
+        };
+
+        auto state=std::make_shared<State>();
+        const std::string accountName=client->getClientInfo().accountName;
+        const bool success=SteamBot::Modules::Executor::executeWithFiber(std::move(client), [this, state, function=std::forward<FUNC>(function)](SteamBot::Client& client_) mutable {
+            SteamBot::ExecuteOnDestruct finished([this, &state]() {
+                state->done=true;
+                if (!state->abandoned)
+                {
+                    cli.wakeup();
+                }
+            });
+            if (!state->abandoned)
+            {
+                try
+                {
+                    state->result.emplace(function(client_));
+                }
+                catch(...)
+                {
+                    state->exception=std::current_exception();
+                }
+            }
+        });
+
+        if (success)
+        {
+            bool completed=false;
+            SteamBot::ExecuteOnDestruct destructor([&state, &completed]() {
+                if (!completed)
+                {
+                    state->abandoned=true;
+                }
+            });
+
+            completed=waitFor(state->done, accountName);
+            if (completed)
+            {
+                if (state->exception)
+                {
+                    std::rethrow_exception(state->exception);
+                }
+                return std::move(state->result);
+            }
+        }
+        return std::nullopt;
+    }
 
 public:
     class GameInfo
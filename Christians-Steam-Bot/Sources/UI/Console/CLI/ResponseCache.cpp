@@ -0,0 +1,184 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "./ResponseCache.hpp"
+
+#include "Client/ClientInfo.hpp"
+#include "Modules/WebSession.hpp"
+
+/************************************************************************/
+
+typedef SteamBot::UI::ResponseCache ResponseCache;
+
+/************************************************************************/
+
+ResponseCache::ResponseCache()
+{
+    statistics.budget=defaultBudget;
+}
+
+ResponseCache::~ResponseCache() =default;
+
+/************************************************************************/
+
+ResponseCache& ResponseCache::get()
+{
+    static ResponseCache cache;
+    return cache;
+}
+
+/************************************************************************/
+
+std::string ResponseCache::makeKey(const SteamBot::ClientInfo& clientInfo, std::string_view url)
+{
+    std::string key;
+    key.reserve(clientInfo.accountName.size()+1+url.size());
+    key.append(clientInfo.accountName);
+    key.push_back(' ');
+    key.append(url);
+    return key;
+}
+
+/************************************************************************/
+/*
+ * The entry itself, its strings, and a guess for the list and index
+ * nodes.
+ */
+
+size_t ResponseCache::Entry::getSize() const
+{
+    return sizeof(Entry)+key.capacity()+etag.capacity()+lastModified.capacity()+6*sizeof(void*);
+}
+
+/************************************************************************/
+/*
+ * Drops the least recently used entries until we're within budget.
+ * Call with the mutex locked.
+ */
+
+void ResponseCache::trim()
+{
+    while (statistics.bytes>statistics.budget && !entries.empty())
+    {
+        const Entry& entry=entries.back();
+        statistics.bytes-=entry.getSize();
+        index.erase(entry.key);
+        entries.pop_back();
+    }
+    statistics.entries=entries.size();
+}
+
+/************************************************************************/
+
+void ResponseCache::prepare(const SteamBot::ClientInfo& clientInfo, std::string_view url, SteamBot::HTTPClient::Query& query)
+{
+    const auto key=makeKey(clientInfo, url);
+
+    std::lock_guard<decltype(mutex)> lock(mutex);
+    auto iterator=index.find(key);
+    if (iterator!=index.end())
+    {
+        const Entry& entry=*(iterator->second);
+        if (!entry.etag.empty())
+        {
+            query.request.set(boost::beast::http::field::if_none_match, entry.etag);
+        }
+        if (!entry.lastModified.empty())
+        {
+            query.request.set(boost::beast::http::field::if_modified_since, entry.lastModified);
+        }
+    }
+}
+
+/************************************************************************/
+
+ResponseCache::Result ResponseCache::update(const SteamBot::ClientInfo& clientInfo, std::string_view url, const SteamBot::HTTPClient::Query& query)
+{
+    const auto& response=query.response;
+
+    Result result;
+    result.status=static_cast<unsigned int>(response.result());
+
+    auto key=makeKey(clientInfo, url);
+
+    std::lock_guard<decltype(mutex)> lock(mutex);
+    auto iterator=index.find(key);
+
+    if (response.result()==boost::beast::http::status::not_modified)
+    {
+        if (iterator!=index.end())
+        {
+            entries.splice(entries.begin(), entries, iterator->second);
+            result.status=static_cast<unsigned int>(boost::beast::http::status::ok);
+            result.bytes=iterator->second->bytes;
+            result.cached=true;
+            statistics.hits++;
+        }
+        else
+        {
+            // The page was dropped after we sent the conditional headers
+            result.evicted=true;
+            statistics.misses++;
+            statistics.evicted++;
+        }
+        return result;
+    }
+
+    statistics.misses++;
+    result.bytes=response.body().size();
+
+    if (iterator!=index.end())
+    {
+        statistics.bytes-=iterator->second->getSize();
+        entries.erase(iterator->second);
+        index.erase(iterator);
+    }
+
+    if (response.result()==boost::beast::http::status::ok)
+    {
+        Entry entry;
+        if (auto field=response.find(boost::beast::http::field::etag); field!=response.end())
+        {
+            entry.etag=std::string(field->value());
+        }
+        if (auto field=response.find(boost::beast::http::field::last_modified); field!=response.end())
+        {
+            entry.lastModified=std::string(field->value());
+        }
+        if (!entry.etag.empty() || !entry.lastModified.empty())
+        {
+            entry.key=std::move(key);
+            entry.bytes=result.bytes;
+            statistics.bytes+=entry.getSize();
+            entries.push_front(std::move(entry));
+            index.emplace(entries.front().key, entries.begin());
+        }
+    }
+
+    trim();
+    return result;
+}
+
+/************************************************************************/
+
+ResponseCache::Statistics ResponseCache::getStatistics() const
+{
+    std::lock_guard<decltype(mutex)> lock(mutex);
+    return statistics;
+}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+
+/************************************************************************/
+
+namespace SteamBot
+{
+    class ClientInfo;
+
+    namespace HTTPClient
+    {
+        class Query;
+    }
+}
+
+/************************************************************************/
+/*
+ * A small conditional-GET cache for load-url/load-urls.
+ *
+ * For responses that come with an ETag or Last-Modified header, we
+ * remember these validators and the size of the page, per account
+ * and URL. The next request for the same page is sent with
+ * If-None-Match/If-Modified-Since, and a "304 Not Modified" answer
+ * counts as a hit.
+ *
+ * Nothing in the bot looks at the page bodies, so we don't keep them;
+ * the savings are the bodies that Steam doesn't send again.
+ *
+ * The entries are limited to "budget" bytes for all accounts
+ * together; the least recently used entries are dropped first.
+ *
+ * This is used from the client threads, so everything is locked.
+ */
+
+namespace SteamBot
+{
+    namespace UI
+    {
+        class ResponseCache
+        {
+        public:
+            struct Result
+            {
+                unsigned int status=0;
+                size_t bytes=0;
+                bool cached=false;
+                bool evicted=false;		// got a 304, but the page was dropped since prepare()
+            };
+
+            struct Statistics
+            {
+                unsigned long long hits=0;
+                unsigned long long misses=0;
+                unsigned long long evicted=0;	// included in misses
+                size_t entries=0;
+                size_t bytes=0;
+                size_t budget=0;
+            };
+
+        private:
+            struct Entry
+            {
+                std::string key;
+                std::string etag;
+                std::string lastModified;
+                size_t bytes=0;			// size of the page
+
+            public:
+                // approximate memory used by the entry
+                size_t getSize() const;
+            };
+
+        private:
+            mutable std::mutex mutex;
+            std::list<Entry> entries;		// most recently used first
+            std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+            Statistics statistics;
+
+        private:
+            ResponseCache();
+            ~ResponseCache();
+
+            static std::string makeKey(const SteamBot::ClientInfo&, std::string_view);
+            void trim();
+
+        public:
+            static ResponseCache& get();
+
+        public:
+            static constexpr size_t defaultBudget=1024*1024;
+
+            // adds the conditional headers to the query, if we have the page
+            void prepare(const SteamBot::ClientInfo&, std::string_view, SteamBot::HTTPClient::Query&);
+
+            // remembers the validators of the response, or looks up the page if we got a 304
+            Result update(const SteamBot::ClientInfo&, std::string_view, const SteamBot::HTTPClient::Query&);
+
+            Statistics getStatistics() const;
+        };
+    }
+}
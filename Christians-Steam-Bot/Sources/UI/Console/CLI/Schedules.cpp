@@ -0,0 +1,198 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "./Schedules.hpp"
+
+#include "UI/CLI.hpp"
+#include "UI/Command.hpp"
+#include "Client/ClientInfo.hpp"
+#include "Helpers/JSON.hpp"
+#include "Helpers/ParseNumber.hpp"
+#include "Helpers/Destruct.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+/************************************************************************/
+
+namespace Schedules=SteamBot::UI::Schedules;
+
+/************************************************************************/
+/*
+ * FNV-1a, since std::hash isn't guaranteed to give us the same offset
+ * after a restart.
+ */
+
+unsigned int Schedules::Job::getMinute(std::string_view accountName) const
+{
+    uint32_t hash=2166136261u;
+    auto add=[&hash](std::string_view string) {
+        for (const char c : string)
+        {
+            hash^=static_cast<uint8_t>(c);
+            hash*=16777619u;
+        }
+    };
+    add(accountName);
+    add(":");
+    add(name);
+
+    return (minute+hash%(jitter+1))%(24*60);
+}
+
+/************************************************************************/
+
+std::vector<Schedules::Job> Schedules::load(const SteamBot::ClientInfo& clientInfo)
+{
+    std::vector<Job> jobs;
+
+    auto& dataFile=SteamBot::DataFile::get(clientInfo.accountName, SteamBot::DataFile::FileType::Account);
+    dataFile.examine([&jobs](const boost::json::value& json) {
+        if (auto array=SteamBot::JSON::getItem(json, "Schedules"))
+        {
+            for (const auto& item : array->as_array())
+            {
+                const auto& object=item.as_object();
+                auto& job=jobs.emplace_back();
+                job.name=object.at("name").as_string().subview();
+                job.command=object.at("command").as_string().subview();
+                job.minute=object.at("minute").to_number<unsigned int>();
+                job.jitter=object.at("jitter").to_number<unsigned int>();
+                job.paused=object.at("paused").as_bool();
+                if (auto last=object.if_contains("last"))
+                {
+                    job.lastRun=std::chrono::system_clock::time_point(std::chrono::seconds(last->to_number<int64_t>()));
+                }
+            }
+        }
+    });
+
+    return jobs;
+}
+
+/************************************************************************/
+
+void Schedules::save(const SteamBot::ClientInfo& clientInfo, const std::vector<Job>& jobs)
+{
+    auto& dataFile=SteamBot::DataFile::get(clientInfo.accountName, SteamBot::DataFile::FileType::Account);
+    dataFile.update([&jobs](boost::json::value& json) {
+        if (jobs.empty())
+        {
+            SteamBot::JSON::eraseItem(json, "Schedules");
+        }
+        else
+        {
+            boost::json::array array;
+            for (const auto& job : jobs)
+            {
+                boost::json::object object;
+                object["name"]=job.name;
+                object["command"]=job.command;
+                object["minute"]=job.minute;
+                object["jitter"]=job.jitter;
+                object["paused"]=job.paused;
+                if (job.lastRun!=std::chrono::system_clock::time_point())
+                {
+                    object["last"]=std::chrono::duration_cast<std::chrono::seconds>(job.lastRun.time_since_epoch()).count();
+                }
+                array.emplace_back(std::move(object));
+            }
+            SteamBot::JSON::createItem(json, "Schedules")=std::move(array);
+        }
+        return true;
+    });
+}
+
+/************************************************************************/
+/*
+ * The command might change the schedules itself, so we reload them
+ * before recording the time.
+ *
+ * "schedules add" doesn't take jobs that run "schedules", but the
+ * files can be edited by hand; so we also refuse to run a job from
+ * inside another one.
+ */
+
+bool Schedules::run(SteamBot::UI::CLI& cli, const SteamBot::ClientInfo& clientInfo, const std::string& name)
+{
+    std::string command;
+    {
+        const auto jobs=load(clientInfo);
+        auto iterator=std::find_if(jobs.begin(), jobs.end(), [&name](const Job& job) { return job.name==name; });
+        if (iterator==jobs.end())
+        {
+            return false;
+        }
+        command=iterator->command;
+    }
+
+    static bool running=false;
+    if (running)
+    {
+        std::cout << "scheduled job \"" << name << "\" cannot be run from another scheduled job" << std::endl;
+        return true;
+    }
+
+    std::cout << "running scheduled job \"" << name << "\" on account " << clientInfo.accountName << std::endl;
+    {
+        running=true;
+        SteamBot::ExecuteOnDestruct done([]() { running=false; });
+        cli.command(clientInfo.accountName+": "+command);
+    }
+
+    auto jobs=load(clientInfo);
+    auto iterator=std::find_if(jobs.begin(), jobs.end(), [&name](const Job& job) { return job.name==name; });
+    if (iterator!=jobs.end())
+    {
+        iterator->lastRun=std::chrono::system_clock::now();
+        save(clientInfo, jobs);
+    }
+    return true;
+}
+
+/************************************************************************/
+
+bool Schedules::parseTime(std::string_view string, unsigned int& minute)
+{
+    const auto colon=string.find(':');
+    if (colon==std::string_view::npos)
+    {
+        return false;
+    }
+
+    unsigned int hours, minutes;
+    if (!SteamBot::parseNumber(string.substr(0, colon), hours) || hours>=24 ||
+        !SteamBot::parseNumber(string.substr(colon+1), minutes) || minutes>=60)
+    {
+        return false;
+    }
+
+    minute=hours*60+minutes;
+    return true;
+}
+
+/************************************************************************/
+
+std::string Schedules::timeString(unsigned int minute)
+{
+    std::ostringstream stream;
+    stream << std::setfill('0') << std::setw(2) << (minute/60)%24 << ':' << std::setw(2) << minute%60;
+    return std::move(stream).str();
+}
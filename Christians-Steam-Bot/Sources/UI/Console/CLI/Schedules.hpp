@@ -0,0 +1,73 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+
+/************************************************************************/
+/*
+ * Scheduled commands are stored in the account data file, like the
+ * groups. Each job runs a command line for its account once a day, at
+ * a UTC time plus a per-account offset of up to "jitter" minutes, so
+ * running the same job on many accounts doesn't hit Steam all at once.
+ *
+ * The jobs are run by ConsoleUI::Scheduler.
+ */
+
+namespace SteamBot
+{
+    class ClientInfo;
+
+    namespace UI
+    {
+        class CLI;
+
+        namespace Schedules
+        {
+            class Job
+            {
+            public:
+                std::string name;
+                std::string command;
+                unsigned int minute=0;		// of the day, UTC
+                unsigned int jitter=0;		// in minutes
+                bool paused=false;
+                std::chrono::system_clock::time_point lastRun;
+
+            public:
+                // the minute of the day, with the offset for the account
+                unsigned int getMinute(std::string_view) const;
+            };
+
+            std::vector<Job> load(const SteamBot::ClientInfo&);
+            void save(const SteamBot::ClientInfo&, const std::vector<Job>&);
+
+            // runs the job on the UI thread, and records the time
+            bool run(SteamBot::UI::CLI&, const SteamBot::ClientInfo&, const std::string& name);
+
+            // "HH:MM"
+            bool parseTime(std::string_view, unsigned int&);
+            std::string timeString(unsigned int);
+        }
+    }
+}
@@ -52,7 +52,8 @@ namespace SteamBot
 
 ConsoleUI::ConsoleUI()
     : getLine(std::make_unique<GetLine>()),
-      manager(ManagerBase::create(*this))
+      manager(ManagerBase::create(*this)),
+      scheduler(std::make_unique<Scheduler>(*this))
 {
     manager->setMode(ManagerBase::Mode::NoInput);
 }
@@ -70,14 +71,21 @@ void ConsoleUI::quit()
 
 /************************************************************************/
 
-void ConsoleUI::performCli()
+SteamBot::UI::CLI& ConsoleUI::getCli()
 {
     assert(SteamBot::UI::Thread::isThread());
     if (!cli)
     {
         cli=std::make_unique<CLI>(*this);
     }
-    cli->run();
+    return *cli;
+}
+
+/************************************************************************/
+
+void ConsoleUI::performCli()
+{
+    getCli().run();
 }
 
 /************************************************************************/
@@ -27,6 +27,9 @@
 #include "./GetLine.hpp"
 
 #include <iostream>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 /************************************************************************/
 
@@ -49,17 +52,20 @@ namespace SteamBot
         public:
             class ManagerBase;
             class Manager;
+            class Scheduler;
 
         private:
             std::unique_ptr<GetLine> getLine;
             std::unique_ptr<ManagerBase> manager;
             std::unique_ptr<CLI> cli;
+            std::unique_ptr<Scheduler> scheduler;
 
         public:
             ConsoleUI();
             virtual ~ConsoleUI();
 
         private:
+            CLI& getCli();
             void performCli();
 
         private:
@@ -114,3 +120,31 @@ public:
     static std::unique_ptr<ManagerBase> create(ConsoleUI&);
     virtual ~ManagerBase();
 };
+
+/************************************************************************/
+/*
+ * Another thread, which wakes up at the start of every minute and
+ * has the UI thread run the scheduled jobs that are due.
+ *
+ * See CLI/Schedules.hpp for the jobs.
+ */
+
+class SteamBot::UI::ConsoleUI::Scheduler
+{
+private:
+    ConsoleUI& ui;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool quit=false;
+
+    std::thread thread;
+
+private:
+    void body();
+    void runJobs(unsigned int);
+
+public:
+    Scheduler(ConsoleUI&);
+    ~Scheduler();
+};
@@ -32,6 +32,13 @@
 
 #include <iostream>
 #include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+#ifdef _WIN32
+#include <conio.h>
+#endif
 
 namespace SteamBot
 {
@@ -39,6 +46,9 @@ namespace SteamBot
     {
         class GetLine
         {
+        private:
+            std::atomic<bool> woken=false;
+
         public:
             std::istream& get(std::string& result)
             {
@@ -48,6 +58,34 @@ namespace SteamBot
             void cancel()
             {
             }
+
+            void wakeup()
+            {
+                woken=true;
+            }
+
+            bool wait(std::chrono::milliseconds timeout, bool input=true)
+            {
+                const auto end=std::chrono::steady_clock::now()+timeout;
+                do
+                {
+                    if (woken.exchange(false))
+                    {
+                        break;
+                    }
+#ifdef _WIN32
+                    if (input && _kbhit())
+                    {
+                        std::string line;
+                        std::getline(std::cin, line);
+                        return true;
+                    }
+#endif
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+                while (std::chrono::steady_clock::now()<end);
+                return false;
+            }
         };
     }
 }
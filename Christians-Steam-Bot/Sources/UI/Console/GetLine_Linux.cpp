@@ -28,6 +28,8 @@
 #include <array>
 #include <cassert>
 #include <iostream>
+#include <algorithm>
+#include <limits>
 
 #include <poll.h>
 #include <sys/eventfd.h>
@@ -75,7 +77,25 @@ void GetLine::cancel()
 
 /************************************************************************/
 
-std::istream& GetLine::get(std::string& result)
+void GetLine::wakeup()
+{
+    if (eventfd_write(event, 1)!=0)
+    {
+        int Errno=errno;
+        throw std::system_error(Errno, std::generic_category());
+    }
+}
+
+/************************************************************************/
+
+/*
+ * Waits for the eventFd or stdin, with a timeout in milliseconds.
+ * Returns true if stdin is ready, false on timeout or wakeup().
+ *
+ * If "input" is false, we only wait for the eventFd.
+ */
+
+bool GetLine::poll(int timeout, bool input)
 {
     std::array<pollfd, 2> pollFds{};
 
@@ -86,41 +106,65 @@ std::istream& GetLine::get(std::string& result)
     assert(pollFds[1].fd==0);
     pollFds[1].events=POLLIN;
 
-    while (true)
+    const auto n=::poll(pollFds.data(), input ? 2 : 1, timeout);
+    if (n<0)
     {
-        const auto n=poll(pollFds.data(), pollFds.size(), -1);
-        assert(n!=0);
-        if (n<0)
-        {
-            int Errno=errno;
-            throw std::system_error(Errno, std::generic_category());
-        }
+        int Errno=errno;
+        throw std::system_error(Errno, std::generic_category());
+    }
+    if (n==0)
+    {
+        return false;
+    }
 
-        if ((pollFds[0].revents | pollFds[1].revents) & (POLLERR | POLLHUP | POLLNVAL))
-        {
-            // Not sure what to do if that happens
-            assert(false);
-        }
+    if ((pollFds[0].revents | pollFds[1].revents) & (POLLERR | POLLHUP | POLLNVAL))
+    {
+        // Not sure what to do if that happens
+        assert(false);
+    }
 
-        if (pollFds[0].revents & POLLIN)
-        {
-            uint64_t value;
-            int rc=eventfd_read(event, &value);
-            assert(rc==0);
-        }
+    if (pollFds[0].revents & POLLIN)
+    {
+        uint64_t value;
+        int rc=eventfd_read(event, &value);
+        assert(rc==0);
+    }
 
-        if (cancelled.test())
-        {
-            BOOST_LOG_TRIVIAL(info) << "getLine cancelled";
-            cancelled.clear();
-            throw SteamBot::OperationCancelledException();
-        }
+    if (cancelled.test())
+    {
+        BOOST_LOG_TRIVIAL(info) << "getLine cancelled";
+        cancelled.clear();
+        throw SteamBot::OperationCancelledException();
+    }
 
-        if (pollFds[1].revents & POLLIN)
-        {
-            return std::getline(std::cin, result);
-        }
+    return (pollFds[1].revents & POLLIN)!=0;
+}
+
+/************************************************************************/
+
+std::istream& GetLine::get(std::string& result)
+{
+    while (!poll(-1, true))
+    {
+    }
+    return std::getline(std::cin, result);
+}
+
+/************************************************************************/
+/*
+ * Note: the line that was entered is discarded.
+ */
+
+bool GetLine::wait(std::chrono::milliseconds timeout, bool input)
+{
+    const auto milliseconds=std::min<std::chrono::milliseconds::rep>(timeout.count(), std::numeric_limits<int>::max());
+    if (poll(static_cast<int>(milliseconds), input))
+    {
+        std::string line;
+        std::getline(std::cin, line);
+        return true;
     }
+    return false;
 }
 
 /************************************************************************/
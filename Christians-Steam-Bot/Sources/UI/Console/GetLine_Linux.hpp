@@ -26,6 +26,7 @@
 #include <string>
 #include <atomic>
 #include <istream>
+#include <chrono>
 
 /************************************************************************/
 /*
@@ -53,6 +54,9 @@ namespace SteamBot
             int event=-1;
             std::atomic_flag cancelled;
 
+        private:
+            bool poll(int, bool);
+
         public:
             GetLine();
             ~GetLine();
@@ -60,6 +64,13 @@ namespace SteamBot
         public:
             std::istream& get(std::string&);
             void cancel();
+
+            // makes a wait() return early; can be called from any thread
+            void wakeup();
+
+            // returns true if the user pressed RETURN within the time.
+            // With input=false, stdin is left alone.
+            bool wait(std::chrono::milliseconds, bool input=true);
         };
     }
 }
@@ -27,26 +27,33 @@
 #include "EnumString.hpp"
 
 #include <mutex>
-#include <condition_variable>
 #include <thread>
+#include <array>
 #include <cassert>
 
 #include <termios.h>
 #include <unistd.h>
-#include <signal.h>
-#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 
 /************************************************************************/
 
 typedef SteamBot::UI::ConsoleUI::Manager Manager;
 
 /************************************************************************/
+/*
+ * The thread only watches stdin for the command key, using epoll on
+ * stdin and an eventfd. setMode() changes the terminal settings on
+ * the calling thread and just pokes the eventfd, so it doesn't have
+ * to wait for the thread.
+ *
+ * We only read from stdin with the mutex locked, after checking the
+ * mode; once setMode() has returned, the thread won't take any more
+ * characters away from GetLine.
+ */
 
 class SteamBot::UI::ConsoleUI::Manager : public SteamBot::UI::ConsoleUI::ManagerBase
 {
-private:
-    static constexpr int signalNumber=SIGUSR1;
-
 private:
     static void throwErrno(int errno_=errno);
     static int getFd();
@@ -55,25 +62,19 @@ private:
     class SavedTermios;
 
 private:
-    static inline std::thread thread;
+    std::thread thread;
+    int epoll=-1;
+    int event=-1;
 
-    static inline std::mutex mutex;
-    static inline std::condition_variable condition;
-    static inline Mode newMode=Mode::Startup;
+    std::mutex mutex;
+    Mode mode=Mode::LineInput;
+    bool commandKey=false;
+    std::unique_ptr<SavedTermios> savedTermios;
 
 private:
-    class SignalHandler
-    {
-    private:
-        static inline bool received=false;
-
-    public:
-        static void handler(int number);
-        static void install();
-        static bool checkAndReset();
-    };
+    bool isWatching() const;
+    void wakeup();
 
-private:
     virtual void setMode(Mode) override;
     void body();
 
@@ -100,40 +101,6 @@ int Manager::getFd()
     return fd;
 }
 
-/************************************************************************/
-
-void Manager::SignalHandler::handler(int number)
-{
-    assert(number==signalNumber);
-    received=true;
-}
-
-/************************************************************************/
-
-void Manager::SignalHandler::install()
-{
-    sigset_t blockset;
-    sigemptyset(&blockset);
-    sigaddset(&blockset, signalNumber);
-    pthread_sigmask(SIG_BLOCK, &blockset, nullptr);
-
-    struct sigaction sa;
-    sa.sa_sigaction=nullptr;
-    sa.sa_handler=&handler;
-    sa.sa_flags=0;
-	sigemptyset(&sa.sa_mask);
-    sigaction(signalNumber, &sa, nullptr);
-}
-
-/************************************************************************/
-
-bool Manager::SignalHandler::checkAndReset()
-{
-    bool result=received;
-    received=false;
-    return result;
-}
-
 /************************************************************************/
 /*
  * https://stackoverflow.com/questions/421860/capture-characters-from-standard-input-without-waiting-for-enter-to-be-pressed
@@ -194,113 +161,103 @@ public:
 
 /************************************************************************/
 /*
- * Signal stuff: https://lwn.net/Articles/176911/
+ * Call with the mutex locked
  */
 
-void Manager::body()
+bool Manager::isWatching() const
 {
-    SignalHandler::install();
+    return mode==Mode::NoInput && !commandKey;
+}
 
+/************************************************************************/
+
+void Manager::wakeup()
+{
+    if (eventfd_write(event, 1)!=0)
     {
-        std::lock_guard<decltype(mutex)> lock(mutex);
-        assert(newMode==Mode::Startup);
-        newMode=Mode::None;
+        throwErrno();
     }
-    condition.notify_one();
+}
 
-    sigset_t emptyset;
-    sigemptyset(&emptyset);
+/************************************************************************/
 
-    std::unique_ptr<SavedTermios> savedTermios;
-    bool commandKey=false;
-    Mode mode=Mode::LineInput;
-    while (mode!=Mode::Shutdown)
+void Manager::body()
+{
+    bool watching=false;
+    while (true)
     {
-        BOOST_LOG_TRIVIAL(debug) << "Console manager: current mode is " << SteamBot::enumToString(mode) << "; commandKey " << commandKey;
-
-        struct pollfd pfd;
-        pfd.events=POLLIN;
-        if (mode==Mode::NoInput && !commandKey)
         {
-            pfd.fd=getFd();
-        }
-        else
-        {
-            pfd.fd=-1;
-        }
+            std::lock_guard<decltype(mutex)> lock(mutex);
 
-        if (ppoll(&pfd, 1, nullptr, &emptyset)<0)
-        {
-            if (errno!=EINTR)
+            BOOST_LOG_TRIVIAL(debug) << "Console manager: current mode is " << SteamBot::enumToString(mode) << "; commandKey " << commandKey;
+
+            if (mode==Mode::Shutdown)
             {
-                throwErrno();
+                break;
             }
-        }
 
-        if (SignalHandler::checkAndReset())
-        {
-        }
-        else if ((pfd.revents & (POLLERR | POLLHUP | POLLIN)))
-        {
-            char c;
-            switch(read(pfd.fd, &c, 1))
+            if (watching!=isWatching())
             {
-            case 0:
-                throwErrno(0);
-                break;
+                watching=!watching;
 
-            case 1:
-                if (c=='\n' || c=='\t')
+                struct epoll_event ev{};
+                ev.events=EPOLLIN;
+                ev.data.fd=getFd();
+                if (epoll_ctl(epoll, watching ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, getFd(), &ev)<0)
                 {
-                    commandKey=true;
+                    throwErrno();
                 }
-                break;
+            }
+        }
 
-            default:
+        std::array<struct epoll_event, 2> events;
+        const int count=epoll_wait(epoll, events.data(), static_cast<int>(events.size()), -1);
+        if (count<0)
+        {
+            if (errno!=EINTR)
+            {
                 throwErrno();
-                break;
             }
+            continue;
         }
 
+        bool execute=false;
+        for (int i=0; i<count; i++)
         {
-            std::lock_guard<decltype(mutex)> lock(mutex);
-            switch(newMode)
+            if (events[i].data.fd==event)
             {
-            case Mode::NoInput:
-                savedTermios.reset();
-                savedTermios=std::make_unique<SavedTermios>(Mode::NoInput);
-                mode=Mode::NoInput;
-                commandKey=false;
-                break;
-
-            case Mode::LineInput:
-                savedTermios.reset();
-                mode=Mode::LineInput;
-                commandKey=false;
-                break;
-
-            case Mode::LineInputNoEcho:
-                savedTermios.reset();
-                savedTermios=std::make_unique<SavedTermios>(Mode::LineInputNoEcho);
-                mode=Mode::LineInputNoEcho;
-                commandKey=false;
-                break;
-
-            case Mode::None:
-                break;
-
-            case Mode::Shutdown:
-                mode=Mode::Shutdown;
-                break;
-
-            default:
-                assert(false);
+                eventfd_t value;
+                eventfd_read(event, &value);
+            }
+            else if (events[i].events & (EPOLLERR | EPOLLHUP | EPOLLIN))
+            {
+                std::lock_guard<decltype(mutex)> lock(mutex);
+                if (isWatching())
+                {
+                    char c;
+                    switch(read(getFd(), &c, 1))
+                    {
+                    case 0:
+                        throwErrno(0);
+                        break;
+
+                    case 1:
+                        if (c=='\n' || c=='\t')
+                        {
+                            commandKey=true;
+                            execute=true;
+                        }
+                        break;
+
+                    default:
+                        throwErrno();
+                        break;
+                    }
+                }
             }
-            newMode=Mode::None;
         }
-        condition.notify_one();
 
-        if (commandKey && mode==Mode::NoInput)
+        if (execute)
         {
             executeOnThread([this](){ ui.performCli(); });
         }
@@ -312,14 +269,32 @@ void Manager::body()
 Manager::Manager(SteamBot::UI::ConsoleUI& ui_)
     : ManagerBase(ui_)
 {
+    if ((epoll=epoll_create1(EPOLL_CLOEXEC))<0 || (event=eventfd(0, EFD_CLOEXEC))<0)
+    {
+        const int errno_=errno;
+        if (epoll>=0)
+        {
+            close(epoll);
+        }
+        throwErrno(errno_);
+    }
+
+    struct epoll_event ev{};
+    ev.events=EPOLLIN;
+    ev.data.fd=event;
+    if (epoll_ctl(epoll, EPOLL_CTL_ADD, event, &ev)<0)
+    {
+        const int errno_=errno;
+        close(event);
+        close(epoll);
+        throwErrno(errno_);
+    }
+
     thread=std::thread([this](){
         BOOST_LOG_TRIVIAL(debug) << "Console manager thread running";
         body();
         BOOST_LOG_TRIVIAL(debug) << "Console manager thread exiting";
     });
-
-    std::unique_lock<decltype(mutex)> lock(mutex);
-    condition.wait(lock, [this](){ return newMode==Mode::None; });
 }
 
 /************************************************************************/
@@ -328,25 +303,37 @@ Manager::~Manager()
 {
     setMode(Mode::Shutdown);
     thread.join();
+    close(event);
+    close(epoll);
 }
 
 /************************************************************************/
 
-void Manager::setMode(Mode mode)
+void Manager::setMode(Mode newMode)
 {
     {
         std::lock_guard<decltype(mutex)> lock(mutex);
-        assert(newMode==Mode::None);
-        newMode=mode;
-    }
 
-    if (auto error=pthread_kill(thread.native_handle(), signalNumber))
-    {
-        throwErrno(error);
-    }
+        savedTermios.reset();
+        switch(newMode)
+        {
+        case Mode::NoInput:
+        case Mode::LineInputNoEcho:
+            savedTermios=std::make_unique<SavedTermios>(newMode);
+            break;
+
+        case Mode::LineInput:
+        case Mode::Shutdown:
+            break;
 
-    std::unique_lock<decltype(mutex)> lock(mutex);
-    condition.wait(lock, [this]() { return newMode==Mode::None; });
+        default:
+            assert(false);
+        }
+
+        mode=newMode;
+        commandKey=false;
+    }
+    wakeup();
 }
 
 /************************************************************************/
@@ -0,0 +1,113 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "./Console.hpp"
+#include "./CLI/Schedules.hpp"
+
+#include "Client/ClientInfo.hpp"
+#include "Helpers/Destruct.hpp"
+
+/************************************************************************/
+
+typedef SteamBot::UI::ConsoleUI::Scheduler Scheduler;
+
+/************************************************************************/
+
+Scheduler::Scheduler(SteamBot::UI::ConsoleUI& ui_)
+    : ui(ui_)
+{
+    thread=std::thread([this](){ body(); });
+}
+
+/************************************************************************/
+
+Scheduler::~Scheduler()
+{
+    {
+        std::lock_guard<decltype(mutex)> lock(mutex);
+        quit=true;
+    }
+    condition.notify_one();
+    thread.join();
+}
+
+/************************************************************************/
+/*
+ * If we fell behind (the system was suspended, or the clock was
+ * changed), we just continue with the current minute instead of
+ * catching up on every minute we missed.
+ */
+
+void Scheduler::body()
+{
+    typedef std::chrono::system_clock Clock;
+
+    auto next=std::chrono::floor<std::chrono::minutes>(Clock::now());
+    while (true)
+    {
+        next+=std::chrono::minutes(1);
+        {
+            std::unique_lock<decltype(mutex)> lock(mutex);
+            if (condition.wait_until(lock, next, [this](){ return quit; }))
+            {
+                return;
+            }
+        }
+
+        const auto now=std::chrono::floor<std::chrono::minutes>(Clock::now());
+        if (now>next)
+        {
+            next=now;
+        }
+
+        const auto minute=static_cast<unsigned int>((next.time_since_epoch()/std::chrono::minutes(1))%(24*60));
+        executeOnThread([this, minute](){ runJobs(minute); });
+    }
+}
+
+/************************************************************************/
+/*
+ * Runs on the UI thread. Nobody is there to press RETURN, so the
+ * jobs run with the CLI in non-interactive mode.
+ *
+ * While the user is in command mode, the UI thread is busy reading
+ * the command line, so the jobs only run when command mode ends;
+ * we still run them then, for the minute they were due.
+ */
+
+void Scheduler::runJobs(unsigned int minute)
+{
+    auto& cli=ui.getCli();
+    cli.interactive=false;
+    SteamBot::ExecuteOnDestruct restore([&cli]() { cli.interactive=true; });
+
+    for (const SteamBot::ClientInfo* clientInfo : SteamBot::ClientInfo::getClients())
+    {
+        if (clientInfo->getClient())
+        {
+            for (const auto& job : SteamBot::UI::Schedules::load(*clientInfo))
+            {
+                if (!job.paused && job.getMinute(clientInfo->accountName)==minute)
+                {
+                    SteamBot::UI::Schedules::run(cli, *clientInfo, job.name);
+                }
+            }
+        }
+    }
+}
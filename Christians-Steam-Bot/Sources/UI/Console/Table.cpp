@@ -18,8 +18,7 @@
  */
 
 #include "UI/Table.hpp"
-
-#include "Helpers/StringCompare.hpp"
+#include "UI/Sort.hpp"
 
 #include <cassert>
 #include <algorithm>
@@ -148,7 +147,7 @@ std::string_view TableBase::getFiller(size_t column) const
 void TableBase::sort(size_t column)
 {
     assert(column<widths.size());
-    std::sort(fields.begin(), fields.end(), [column](const std::vector<std::string>& left, const std::vector<std::string>& right) {
-        return SteamBot::caseInsensitiveStringCompare_less(left[column], right[column]);
+    SteamBot::UI::sortItems(fields, [column](const std::vector<std::string>& line) {
+        return SteamBot::UI::makeSortKey(line[column]);
     });
 }
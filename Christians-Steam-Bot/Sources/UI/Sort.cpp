@@ -0,0 +1,35 @@
+/*
+ * This file is part of "Christians-Steam-Framework"
+ * Copyright (C) 2023- Christian Stieber
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 3, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file LICENSE.  If not see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "UI/Sort.hpp"
+#include "Helpers/StringCompare.hpp"
+
+/************************************************************************/
+
+std::weak_ordering SteamBot::UI::SortKey::operator<=>(const SortKey& other) const
+{
+    return SteamBot::caseInsensitiveStringCompare(string, other.string);
+}
+
+/************************************************************************/
+
+bool SteamBot::UI::SortKey::operator==(const SortKey& other) const
+{
+    return (*this<=>other)==std::weak_ordering::equivalent;
+}